@@ -71,9 +71,14 @@
 #define U8G2_16BIT
 
 
+/* 32 bit environments, some optimizations are enabled for these systems only, the list is in u8x8.h */
+#ifdef U8X8_32BIT_PLATFORM
+#define U8G2_32BIT_PLATFORM
+#endif
+
 /* always enable U8G2_16BIT on 32bit environments, see issue https://github.com/olikraus/u8g2/issues/1222 */
 #ifndef U8G2_16BIT
-#if defined(unix) || defined(__unix__) || defined(__arm__) || defined(__xtensa__) || defined(xtensa) || defined(__arc__) || defined(ESP8266) || defined(ESP_PLATFORM) || defined(__LUATOS__)
+#ifdef U8G2_32BIT_PLATFORM
 #define U8G2_16BIT
 #endif
 #endif
@@ -97,6 +102,159 @@
 #define U8G2_WITH_HVLINE_SPEED_OPTIMIZATION
 #endif
 
+/*
+  The following macro enables draw color specific low level hvline procedures.
+  For each buffer layout, there will be one procedure for each draw color (0, 1 and 2), 
+  selected for the current draw color before the line is drawn, so that the draw color 
+  is not checked for each byte.
+  It requires the HVLine speed optimization and will consume some more flash memory 
+  (six additional procedures). Enabled for 32 bit systems only.
+*/
+#ifdef U8G2_WITH_HVLINE_SPEED_OPTIMIZATION
+#ifdef U8G2_32BIT_PLATFORM
+#ifndef U8G2_WITHOUT_HVLINE_COLOR_SPECIALIZATION
+#define U8G2_WITH_HVLINE_COLOR_SPECIALIZATION
+#endif
+#endif
+#endif
+
+/*
+  The following macro enables the low level box procedures (ll_box): u8g2_DrawBox()
+  is clipped once and the box is written directly into the buffer, instead
+  of drawing each row with u8g2_DrawHVLine(). 
+  It requires the HVLine speed optimization and will consume some more flash memory.
+  Enabled for 32 bit systems only.
+*/
+#ifdef U8G2_WITH_HVLINE_SPEED_OPTIMIZATION
+#ifdef U8G2_32BIT_PLATFORM
+#ifndef U8G2_WITHOUT_LL_BOX
+#define U8G2_WITH_LL_BOX
+#endif
+#endif
+#endif
+
+/*
+  The following macro enables the bitmap cache for decoded glyphs:
+    void u8g2_SetFontBitmapCache(u8g2_t *u8g2, u8g2_font_bitmap_t *buf, uint8_t cnt)
+  Recently used glyphs are kept as 1 bit per pixel bitmaps, so that the run length
+  decoding is skipped for these glyphs. Glyphs with more than U8G2_FONT_BITMAP_SIZE
+  bitmap bytes (width * ((height+7)/8)) are not cached.
+  For buffers with vertical_top_lsb layout and U8G2_R0, the bitmap is copied 
+  directly into the buffer (ll_bitmap procedure). Enabled for 32 bit systems only.
+*/
+#ifdef U8G2_32BIT_PLATFORM
+#ifndef U8G2_WITHOUT_FONT_BITMAP_CACHE
+#define U8G2_WITH_FONT_BITMAP_CACHE
+#endif
+#endif
+
+#ifndef U8G2_FONT_BITMAP_SIZE
+#define U8G2_FONT_BITMAP_SIZE 64
+#endif
+
+/*
+  The following macro enables the 32 bit reservoir for the run length decoder
+  of the glyphs: One run length tuple (0-run, 1-run, first repeat bit) is 
+  decoded with one reservoir refill instead of three calls to 
+  u8g2_font_decode_get_unsigned_bits(). This is enabled for 32 bit systems only.
+*/
+#ifdef U8G2_32BIT_PLATFORM
+#ifndef U8G2_WITHOUT_FONT_BIT_RESERVOIR
+#define U8G2_WITH_FONT_BIT_RESERVOIR
+#endif
+#endif
+
+/*
+  The following macro enables the dirty tile tracking for the full buffer mode:
+    void u8g2_SetDirtyTileBuffer(u8g2_t *u8g2, uint8_t *buf)
+    void u8g2_SendDirtyTiles(u8g2_t *u8g2)
+  Tracking is only active after a tracking buffer has been assigned.
+  If active, u8g2_SendDirtyTiles() will only send the tiles, which have been
+  modified since the last transfer. This is useful for slow interfaces like I2C.
+  Disabled by default, define U8G2_WITH_DIRTY_TILES to enable it.
+*/
+//#define U8G2_WITH_DIRTY_TILES
+
+/*
+  The following macro enables the shadow buffer support:
+    void u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t mode)
+  The shadow buffer is a copy of the display memory (last frame sent to the display).
+  If a shadow buffer is assigned, u8g2_SendBuffer() and u8g2_NextPage() will compare each tile
+  with the shadow buffer and only send the tiles, which have been changed.
+  Unlike the dirty tile tracking, this also detects tiles which are redrawn with the same content.
+  The shadow buffer requires a full frame buffer of RAM. 
+  Disabled by default, define U8G2_WITH_SHADOW_BUFFER to enable it.
+*/
+//#define U8G2_WITH_SHADOW_BUFFER
+
+/*
+  The following macro enables the display list for the page buffer mode:
+    void u8g2_SetDisplayList(u8g2_t *u8g2, uint8_t *buf, size_t size)
+  If a display list is assigned, the first pass of the picture loop will record all
+  draw procedures and u8g2_NextPage() will replay them for all pages. The
+  picture loop is then executed only once. See u8g2_dlist.c for details.
+  Disabled by default, define U8G2_WITH_DISPLAY_LIST to enable it.
+*/
+//#define U8G2_WITH_DISPLAY_LIST
+
+/*
+  The following macro enables the native gray buffer mode for 4 bit gray level 
+  controllers (SSD1322, SSD1327, SH1122): The buffer stores 4 or 2 bit per pixel 
+  and is sent without conversion to the display. Use the "g4" and "g2" setup 
+  procedures, for example u8g2_Setup_ssd1322_nhd_256x64_g4_f(). The gray level is
+  selected with u8g2_SetDrawColor(u8g2, U8G2_DRAW_COLOR_GRAY(level)), level 0..15.
+  Disabled by default, define U8G2_WITH_GRAY_BUFFER to enable it.
+*/
+//#define U8G2_WITH_GRAY_BUFFER
+
+/*
+  The following macro enables the full frame upload: If the buffer contains the
+  complete display memory, u8g2_SendBuffer() sends it with one 
+  U8X8_MSG_DISPLAY_DRAW_FULL_FRAME message (SSD1306: horizontal addressing mode,
+  one data stream instead of one command/data sequence per tile row). 
+  Controllers without support for this message (u8x8->is_full_frame == 0) 
+  receive the tile rows as before.
+  Disabled by default, define U8X8_WITH_FULL_FRAME in u8x8.h to enable it.
+*/
+#ifdef U8X8_WITH_FULL_FRAME
+#ifndef U8G2_WITHOUT_FULL_FRAME_UPLOAD
+#define U8G2_WITH_FULL_FRAME_UPLOAD
+#endif
+#endif
+
+/*
+  The following macro enables the incremental send procedures:
+    void u8g2_SendBufferBegin(u8g2_t *u8g2)
+    uint8_t u8g2_SendBufferStep(u8g2_t *u8g2, uint16_t budget)
+    void u8g2_SendBufferDone(u8g2_t *u8g2)
+  The buffer is sent in several steps with a limited number of tiles per step,
+  so that a cooperative scheduler can run other tasks between the steps.
+  Disabled by default, define U8G2_WITH_INCREMENTAL_SEND to enable it.
+*/
+//#define U8G2_WITH_INCREMENTAL_SEND
+
+/*
+  The following macro enables the glyph index for the glyphs 0..255:
+    void u8g2_SetFontGlyphIndex(u8g2_t *u8g2, uint16_t *buf)
+  The index is only active after a buffer with U8G2_FONT_GLYPH_INDEX_CNT entries 
+  (512 bytes RAM) has been assigned. u8g2_SetFont() will then store the position of
+  each glyph in this buffer, so that the glyph data is found without searching the font.
+  Disabled by default, define U8G2_WITH_FONT_GLYPH_INDEX to enable it.
+*/
+//#define U8G2_WITH_FONT_GLYPH_INDEX
+
+/*
+  The following macro enables the lookup of glyphs in the glyph offset table
+  of a font. The offset table is optional and added by "bdfconv -i 1" (dense)
+  or "bdfconv -i 2" (sparse). With the offset table, the glyph data is found
+  without searching the font, but the font requires 3 or 5 bytes more flash 
+  memory per glyph. Fonts with offset table can still be used without this macro, 
+  fonts without offset table are not affected.
+*/
+#ifndef U8G2_WITHOUT_FONT_OFFSET_TABLE
+#define U8G2_WITH_FONT_OFFSET_TABLE
+#endif
+
 /*
   The following macro activates the early intersection check with the current visible area.
   Clipping (and low level intersection calculation) will still happen and is controlled by U8G2_WITH_CLIPPING.
@@ -130,6 +288,77 @@
 #define U8G2_WITH_FONT_ROTATION
 #endif
 
+/*
+  The following macro enables one run length draw procedure for each of the 
+  four glyph directions. The procedure is selected once per glyph, so that
+  the direction is not checked again for each run. This requires about 
+  three times the code of u8g2_font_decode_len() and is enabled for 32 bit
+  systems only.
+*/
+#ifdef U8G2_WITH_FONT_ROTATION
+#ifdef U8G2_32BIT_PLATFORM
+#ifndef U8G2_WITHOUT_FONT_DIR_DECODE
+#define U8G2_WITH_FONT_DIR_DECODE
+#endif
+#endif
+#endif
+
+/*
+  The following macro enables the solid mode box fill: In non-transparent
+  font mode (u8g2_SetFontMode(u8g2, 0)), the glyph cell is filled once with
+  the background color and only the foreground runs are drawn. For strings,
+  the cells of adjacent glyphs are merged into one box. Enabled for 32 bit 
+  systems only.
+*/
+#ifdef U8G2_32BIT_PLATFORM
+#ifndef U8G2_WITHOUT_FONT_SOLID_BOX
+#define U8G2_WITH_FONT_SOLID_BOX
+#endif
+#endif
+
+/* max number of glyphs, which are merged into one background box */
+#ifndef U8G2_FONT_SOLID_GLYPH_CNT
+#define U8G2_FONT_SOLID_GLYPH_CNT 8
+#endif
+
+/*
+  The following macro enables the bitmap procedure for scaled glyphs 
+  (u8g2_DrawStrX2(), u8g2_DrawStrScaled(), ...): Each glyph is decoded once
+  into a bitmap, each column is scaled with a lookup table and written
+  directly into the buffer (ll_bitmap procedure, U8G2_R0 only). Otherwise
+  one line is drawn for each scaled row of a run.
+  Requires U8G2_WITH_FONT_BITMAP_CACHE, but u8g2_SetFontBitmapCache() is 
+  optional. Enabled for 32 bit systems only.
+*/
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+#ifdef U8G2_32BIT_PLATFORM
+#ifndef U8G2_WITHOUT_FONT_SCALE_BITMAP
+#define U8G2_WITH_FONT_SCALE_BITMAP
+#endif
+#endif
+#endif
+
+/* max scale factor for U8G2_WITH_FONT_SCALE_BITMAP */
+#define U8G2_FONT_SCALE_MAX 4
+
+/* 
+  Buffer sizes for U8G2_WITH_FONT_SCALE_BITMAP: Both buffers are local variables, 
+  so drawing a scaled glyph requires about 
+  U8G2_FONT_SCALE_BITMAP_SIZE + U8G2_FONT_SCALE_MAX*U8G2_FONT_SCALE_COLUMN_SIZE
+  (512) bytes of stack. Smaller values reduce the stack usage, but more glyphs
+  are drawn box by box.
+*/
+
+/* max size of one scaled glyph column for U8G2_WITH_FONT_SCALE_BITMAP, larger glyphs are drawn box by box */
+#ifndef U8G2_FONT_SCALE_COLUMN_SIZE
+#define U8G2_FONT_SCALE_COLUMN_SIZE 64
+#endif
+
+/* max size of the unscaled glyph bitmap (width * ((height+7)/8)) for U8G2_WITH_FONT_SCALE_BITMAP */
+#ifndef U8G2_FONT_SCALE_BITMAP_SIZE
+#define U8G2_FONT_SCALE_BITMAP_SIZE 256
+#endif
+
 /*
   U8glib V2 contains support for unicode plane 0 (Basic Multilingual Plane, BMP).
   The following macro activates this support. Deactivation would save some ROM.
@@ -158,6 +387,47 @@
 #define U8G2_WITH_UNICODE
 #endif
 
+/*
+  The following macro enables the glyph cache for unicode glyphs (above 255):
+    void u8g2_SetFontGlyphCache(u8g2_t *u8g2, u8g2_font_glyph_cache_t *buf, uint8_t cnt)
+  The cache remembers the glyph data position for the last used (font, encoding) pairs.
+  The cache is not cleared by u8g2_SetFont(), so it is useful for strings and menus,
+  which mix several large fonts (for example unifont or wqy).
+  Requires U8G2_WITH_UNICODE. Disabled by default, define U8G2_WITH_FONT_GLYPH_CACHE 
+  to enable it.
+*/
+//#define U8G2_WITH_FONT_GLYPH_CACHE
+
+#ifndef U8G2_WITH_UNICODE
+#undef U8G2_WITH_FONT_GLYPH_CACHE
+#endif
+
+/*
+  The following macro enables the cache for the string width calculation:
+    void u8g2_SetStrWidthCache(u8g2_t *u8g2, u8g2_str_width_cache_t *buf, uint8_t cnt)
+  u8g2_GetStrWidth() and u8g2_GetUTF8Width() will remember the width for the 
+  last measured (font, string) pairs. Each entry stores a copy of the string, so 
+  only strings with up to U8G2_STR_WIDTH_CACHE_LEN bytes are cached. Entries 
+  of other fonts are ignored, so strings of different fonts can be mixed. The 
+  number of cache hits and misses is available with u8g2_GetStrWidthCacheHitCnt() 
+  and u8g2_GetStrWidthCacheMissCnt().
+  Disabled by default, define U8G2_WITH_STR_WIDTH_CACHE to enable it.
+*/
+//#define U8G2_WITH_STR_WIDTH_CACHE
+
+#ifndef U8G2_STR_WIDTH_CACHE_LEN
+#define U8G2_STR_WIDTH_CACHE_LEN 24
+#endif
+
+/*
+  The following macro enables the cache for kerning values:
+    void u8g2_SetKerningCache(u8g2_t *u8g2, u8g2_kerning_cache_t *buf, uint8_t cnt)
+  u8g2_GetKerning() and u8g2_GetKerningByTable() will remember the kerning
+  value of the last used (kerning table, first glyph, second glyph) triples. 
+  Disabled by default, define U8G2_WITH_KERNING_CACHE to enable it.
+*/
+//#define U8G2_WITH_KERNING_CACHE
+
 
 /*
   See issue https://github.com/olikraus/u8g2/issues/1561
@@ -181,8 +451,10 @@
 
 #ifdef __GNUC__
 #  define U8G2_NOINLINE __attribute__((noinline))
+#  define U8G2_ALWAYS_INLINE __inline__ __attribute__((always_inline))
 #else
 #  define U8G2_NOINLINE
+#  define U8G2_ALWAYS_INLINE
 #endif
 
 #define U8G2_FONT_SECTION(name) U8X8_FONT_SECTION(name) 
@@ -223,6 +495,9 @@ typedef void (*u8g2_update_dimension_cb)(u8g2_t *u8g2);
 typedef void (*u8g2_update_page_win_cb)(u8g2_t *u8g2);
 typedef void (*u8g2_draw_l90_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
 typedef void (*u8g2_draw_ll_hvline_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+typedef void (*u8g2_draw_b90_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+typedef void (*u8g2_draw_ll_box_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+typedef void (*u8g2_draw_ll_bitmap_cb)(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, u8g2_uint_t bitmap_y, uint8_t bytes_per_column);
 
 typedef uint8_t (*u8g2_get_kerning_cb)(u8g2_t *u8g2, uint16_t e1, uint16_t e2);
 
@@ -263,6 +538,10 @@ struct _u8g2_font_info_t
 #ifdef U8G2_WITH_UNICODE  
   uint16_t start_pos_unicode;
 #endif
+
+  /* offset 23, optional glyph offset table */
+  uint8_t offset_table_type;	/* 0, U8G2_FONT_OFFSET_TABLE_DENSE or U8G2_FONT_OFFSET_TABLE_SPARSE */
+  uint16_t offset_table_size;	/* size of the offset table, the glyphs start at offset 23 + offset_table_size */
 };
 typedef struct _u8g2_font_info_t u8g2_font_info_t;
 
@@ -285,6 +564,10 @@ struct _u8g2_font_decode_t
   uint8_t bg_color;
 #ifdef U8G2_WITH_FONT_ROTATION  
   uint8_t dir;				/* direction */
+#endif
+  uint8_t scale;			/* scale factor for u8g2_DrawGlyphScaled() and u8g2_DrawGlyphX2() */
+#ifdef U8G2_WITH_FONT_DIR_DECODE
+  void (*decode_len)(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground);	/* run length draw procedure for dir, assigned by u8g2_font_setup_decode() */
 #endif
 };
 typedef struct _u8g2_font_decode_t u8g2_font_decode_t;
@@ -297,15 +580,63 @@ struct _u8g2_kerning_t
   const uint16_t *index_to_second_table;
   const uint16_t *second_encoding_table;
   const uint8_t *kerning_values;
+  uint8_t is_sorted;		/* 1: tables are sorted by encoding (bdfconv), 0: older tables, searched linearly */
 };
 typedef struct _u8g2_kerning_t u8g2_kerning_t;
 
+#ifdef U8G2_WITH_KERNING_CACHE
+struct _u8g2_kerning_cache_t
+{
+  const void *kerning;			/* NULL: entry is not used, otherwise u8g2_kerning_t or kerning table */
+  uint16_t e1;
+  uint16_t e2;
+  uint8_t value;
+};
+typedef struct _u8g2_kerning_cache_t u8g2_kerning_cache_t;
+#endif
+
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+struct _u8g2_font_glyph_cache_t
+{
+  const uint8_t *font;			/* NULL: entry is not used */
+  const uint8_t *glyph_data;		/* result of u8g2_font_get_glyph_data(), might be NULL */
+  uint16_t encoding;
+};
+typedef struct _u8g2_font_glyph_cache_t u8g2_font_glyph_cache_t;
+#endif
+
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+struct _u8g2_str_width_cache_t
+{
+  const uint8_t *font;			/* NULL: entry is not used */
+  u8g2_uint_t width;
+  uint8_t len;				/* length of the string */
+  uint8_t is_utf8;			/* 1: u8g2_GetUTF8Width(), 0: u8g2_GetStrWidth() */
+  char str[U8G2_STR_WIDTH_CACHE_LEN];	/* the first len bytes of the string, no terminating zero */
+};
+typedef struct _u8g2_str_width_cache_t u8g2_str_width_cache_t;
+#endif
+
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+/* decoded glyph: column by column, (height+7)/8 bytes per column, LSB is the top pixel */
+struct _u8g2_font_bitmap_t
+{
+  const uint8_t *glyph_data;		/* NULL: entry is not used */
+  uint16_t last_use;			/* value of font_bitmap_cache_clock at the last access */
+  uint8_t bitmap[U8G2_FONT_BITMAP_SIZE];
+};
+typedef struct _u8g2_font_bitmap_t u8g2_font_bitmap_t;
+#endif
+
 
 struct u8g2_cb_struct
 {
   u8g2_update_dimension_cb update_dimension;
   u8g2_update_page_win_cb update_page_win;
   u8g2_draw_l90_cb draw_l90;
+#ifdef U8G2_WITH_LL_BOX
+  u8g2_draw_b90_cb draw_b90;	/* rotate a box, might be NULL: u8g2_DrawBox() will use draw_l90 instead */
+#endif
 };
 
 typedef u8g2_uint_t (*u8g2_font_calc_vref_fnptr)(u8g2_t *u8g2);
@@ -315,6 +646,15 @@ struct u8g2_struct
 {
   u8x8_t u8x8;
   u8g2_draw_ll_hvline_cb ll_hvline;	/* low level hvline procedure */
+#ifdef U8G2_WITH_HVLINE_COLOR_SPECIALIZATION
+  const u8g2_draw_ll_hvline_cb *ll_hvline_color_list;	/* draw color specific ll_hvline procedures or NULL, index is the draw color */
+#endif
+#ifdef U8G2_WITH_LL_BOX
+  u8g2_draw_ll_box_cb ll_box;	/* low level box procedure for the buffer layout of ll_hvline or NULL */
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+  u8g2_draw_ll_bitmap_cb ll_bitmap;	/* low level bitmap procedure for the buffer layout of ll_hvline or NULL */
+#endif
   const u8g2_cb_t *cb;		/* callback drawprocedures, can be replaced for rotation */
   
   /* the following variables must be assigned during u8g2 setup */
@@ -363,6 +703,29 @@ struct u8g2_struct
   u8g2_font_calc_vref_fnptr font_calc_vref;
   u8g2_font_decode_t font_decode;		/* new font decode structure */
   u8g2_font_info_t font_info;			/* new font info structure */
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+  uint16_t *font_glyph_index;		/* NULL or U8G2_FONT_GLYPH_INDEX_CNT glyph positions, see u8g2_SetFontGlyphIndex() */
+  const uint8_t *font_glyph_index_font;	/* the font, for which font_glyph_index was built */
+#endif
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+  u8g2_font_glyph_cache_t *font_glyph_cache;	/* NULL or direct mapped cache, see u8g2_SetFontGlyphCache() */
+  uint8_t font_glyph_cache_mask;		/* number of cache entries minus 1 */
+#endif
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+  u8g2_str_width_cache_t *str_width_cache;	/* NULL or direct mapped cache, see u8g2_SetStrWidthCache() */
+  uint8_t str_width_cache_mask;		/* number of cache entries minus 1 */
+  uint16_t str_width_cache_hit_cnt;
+  uint16_t str_width_cache_miss_cnt;
+#endif
+#ifdef U8G2_WITH_KERNING_CACHE
+  u8g2_kerning_cache_t *kerning_cache;	/* NULL or direct mapped cache, see u8g2_SetKerningCache() */
+  uint8_t kerning_cache_mask;		/* number of cache entries minus 1 */
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+  u8g2_font_bitmap_t *font_bitmap_cache;	/* NULL or cache for decoded glyphs, see u8g2_SetFontBitmapCache() */
+  uint8_t font_bitmap_cache_cnt;		/* number of entries in font_bitmap_cache */
+  uint16_t font_bitmap_cache_clock;	/* incremented with each access to the cache, used for LRU replacement */
+#endif
 
 #ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
   /* 1 of there is an intersection between user_?? and clip_?? box */
@@ -378,11 +741,34 @@ struct u8g2_struct
   uint8_t bitmap_transparency;	/* black pixels will be treated as transparent (not drawn) */
 
   uint8_t draw_color;		/* 0: clear pixel, 1: set pixel, modified and restored by font procedures */
-					/* draw_color can be used also directly by the user API */
+#ifdef U8G2_WITH_GRAY_BUFFER
+  uint8_t bits_per_pixel;		/* 1 for monochrome buffers, 2 or 4 for gray buffers, see u8g2_SetupGrayBuffer() */
+#endif
 					
 	// the following variable should be renamed to is_buffer_auto_clear
   uint8_t is_auto_page_clear; 		/* set to 0 to disable automatic clear of the buffer in firstPage() and nextPage() */
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  uint8_t *dirty_tile_buf;	/* NULL or one bit per tile: dirty tiles (to be sent) followed by drawn tiles (since last clear) */
+  uint32_t dirty_bytes_saved;	/* number of bytes, which were not sent by the last u8g2_SendDirtyTiles() */
+#endif
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  uint8_t *shadow_buf;		/* NULL or a copy of the display memory, see u8g2_SetShadowBuffer() */
+  uint16_t shadow_changed_tiles;	/* number of changed tiles of the last frame */
+  uint16_t shadow_frame_tiles;	/* number of compared tiles of the last frame */
+  uint8_t shadow_mode;		/* U8G2_SHADOW_MODE_DIFF or U8G2_SHADOW_MODE_COUNT */
+  uint8_t is_shadow_valid;	/* 0 until a complete frame has been sent after assigning the shadow buffer */
+#endif
+#ifdef U8G2_WITH_INCREMENTAL_SEND
+  uint8_t send_row;		/* next tile row of the buffer for u8g2_SendBufferStep(), 255: nothing to send */
+  uint8_t send_tx;		/* next tile within this row */
+#endif
+#ifdef U8G2_WITH_DISPLAY_LIST
+  uint8_t *dlist_buf;		/* NULL or memory for the display list, see u8g2_SetDisplayList() */
+  size_t dlist_size;		/* size of dlist_buf in bytes */
+  size_t dlist_pos;		/* used (or required) number of bytes */
+  uint8_t dlist_state;		/* U8G2_DLIST_STATE_OFF, U8G2_DLIST_STATE_RECORD or U8G2_DLIST_STATE_REPLAY */
+#endif
 };
 
 #define u8g2_GetU8x8(u8g2) ((u8x8_t *)(u8g2))
@@ -453,12 +839,18 @@ extern const u8g2_cb_t u8g2_cb_mirror_vertical;
     u8g2_ll_hvline_horizontal_right_lsb
   u8g2_cb			U8G2_R0 .. U8G2_R3
       
+  u8g2_SetupGrayBuffer:
+  buf:			Memory area of size tile_buf_height*<width of the display in pixel>*bits_per_pixel
+  bits_per_pixel:	2 or 4
 */
 
 void u8g2_SetMaxClipWindow(u8g2_t *u8g2);
 void u8g2_SetClipWindow(u8g2_t *u8g2, u8g2_uint_t clip_x0, u8g2_uint_t clip_y0, u8g2_uint_t clip_x1, u8g2_uint_t clip_y1 );
 
 void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_draw_ll_hvline_cb ll_hvline_cb, const u8g2_cb_t *u8g2_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_SetupGrayBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, uint8_t bits_per_pixel, const u8g2_cb_t *u8g2_cb);
+#endif
 void u8g2_SetDisplayRotation(u8g2_t *u8g2, const u8g2_cb_t *u8g2_cb);
 
 void u8g2_SendF(u8g2_t * u8g2, const char *fmt, ...);
@@ -507,6 +899,24 @@ uint8_t *u8g2_m_20_20_f(uint8_t *page_cnt);
 uint8_t *u8g2_m_32_8_1(uint8_t *page_cnt);
 uint8_t *u8g2_m_32_8_2(uint8_t *page_cnt);
 uint8_t *u8g2_m_32_8_f(uint8_t *page_cnt);
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g4_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g4_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g4_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g2_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g2_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g2_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 uint8_t *u8g2_m_13_8_1(uint8_t *page_cnt);
 uint8_t *u8g2_m_13_8_2(uint8_t *page_cnt);
 uint8_t *u8g2_m_13_8_f(uint8_t *page_cnt);
@@ -534,6 +944,78 @@ uint8_t *u8g2_m_32_4_f(uint8_t *page_cnt);
 uint8_t *u8g2_m_12_8_1(uint8_t *page_cnt);
 uint8_t *u8g2_m_12_8_2(uint8_t *page_cnt);
 uint8_t *u8g2_m_12_8_f(uint8_t *page_cnt);
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g4_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g4_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g4_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g2_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g2_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g2_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g4_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g4_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g4_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g2_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g2_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g2_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g4_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g4_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g4_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g2_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g2_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g2_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g4_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g4_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g4_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g2_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g2_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g2_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 uint8_t *u8g2_m_16_5_1(uint8_t *page_cnt);
 uint8_t *u8g2_m_16_5_2(uint8_t *page_cnt);
 uint8_t *u8g2_m_16_5_f(uint8_t *page_cnt);
@@ -633,6 +1115,24 @@ uint8_t *u8g2_m_19_4_f(uint8_t *page_cnt);
 uint8_t *u8g2_m_20_17_1(uint8_t *page_cnt);
 uint8_t *u8g2_m_20_17_2(uint8_t *page_cnt);
 uint8_t *u8g2_m_20_17_f(uint8_t *page_cnt);
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g4_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g4_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g4_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g2_1(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g2_2(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g2_f(uint8_t *page_cnt);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 uint8_t *u8g2_m_26_5_1(uint8_t *page_cnt);
 uint8_t *u8g2_m_26_5_2(uint8_t *page_cnt);
 uint8_t *u8g2_m_26_5_f(uint8_t *page_cnt);
@@ -845,9 +1345,45 @@ void u8g2_Setup_sh1108_i2c_160x160_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8
 void u8g2_Setup_sh1122_256x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_sh1122_256x64_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_sh1122_256x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_sh1122_i2c_256x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_sh1122_i2c_256x64_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_sh1122_i2c_256x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1306_128x32_univision_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1306_128x32_winstar_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1306_128x32_univision_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
@@ -983,15 +1519,87 @@ void u8g2_Setup_ssd1326_i2c_er_256x32_f(u8g2_t *u8g2, const u8g2_cb_t *rotation,
 void u8g2_Setup_ssd1327_ws_96x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_ws_96x64_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_ws_96x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1327_i2c_ws_96x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_ws_96x64_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_ws_96x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1327_seeed_96x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_seeed_96x96_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_seeed_96x96_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1327_i2c_seeed_96x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_seeed_96x96_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_seeed_96x96_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1327_ea_w128128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_midas_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_zjy_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
@@ -1004,6 +1612,42 @@ void u8g2_Setup_ssd1327_ea_w128128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8
 void u8g2_Setup_ssd1327_midas_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_zjy_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_ws_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_midas_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_zjy_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_ws_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_midas_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_zjy_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_ws_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_midas_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_zjy_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_ws_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_midas_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_zjy_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_ws_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_midas_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_zjy_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_ws_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_midas_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_zjy_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_ws_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1327_i2c_ea_w128128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_midas_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_zjy_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
@@ -1016,12 +1660,84 @@ void u8g2_Setup_ssd1327_i2c_ea_w128128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation
 void u8g2_Setup_ssd1327_i2c_midas_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_zjy_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_ws_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1327_visionox_128x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_visionox_128x96_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_visionox_128x96_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1327_i2c_visionox_128x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_visionox_128x96_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1327_i2c_visionox_128x96_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1329_128x96_noname_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1329_128x96_noname_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1329_128x96_noname_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
@@ -1592,12 +2308,60 @@ void u8g2_Setup_ssd1322_240x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_
 void u8g2_Setup_ssd1322_topwin_240x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_240x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_topwin_240x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_topwin_240x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_topwin_240x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_topwin_240x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_topwin_240x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_topwin_240x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_topwin_240x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1322_nhd_256x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_zjy_256x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_nhd_256x64_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_zjy_256x64_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_nhd_256x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_zjy_256x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_zjy_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_zjy_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_zjy_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_zjy_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_zjy_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+void u8g2_Setup_ssd1322_zjy_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+#endif /* U8G2_WITH_GRAY_BUFFER */
 void u8g2_Setup_ssd1322_nhd_128x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_nhd_128x64_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
 void u8g2_Setup_ssd1322_nhd_128x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
@@ -1716,9 +2480,18 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2);
 #define U8G2_USE_DYNAMIC_ALLOC
 #endif
 
+/* number of bytes for one tile row of the buffer */
+#ifdef U8G2_WITH_GRAY_BUFFER
+#define u8g2_GetBufferTileRowSize(u8g2) ((size_t)(u8g2)->u8x8.display_info->tile_width * 8 * (u8g2)->bits_per_pixel)
+#define u8g2_GetBufferBitsPerPixel(u8g2) ((u8g2)->bits_per_pixel)
+#else
+#define u8g2_GetBufferTileRowSize(u8g2) ((size_t)(u8g2)->u8x8.display_info->tile_width * 8)
+#define u8g2_GetBufferBitsPerPixel(u8g2) 1
+#endif
+
 #ifdef U8G2_USE_DYNAMIC_ALLOC
 #define u8g2_SetBufferPtr(u8g2, buf) ((u8g2)->tile_buf_ptr = (buf));
-#define u8g2_GetBufferSize(u8g2) ((u8g2)->u8x8.display_info->tile_width * 8 * (u8g2)->tile_buf_height)
+#define u8g2_GetBufferSize(u8g2) (u8g2_GetBufferTileRowSize(u8g2) * (u8g2)->tile_buf_height)
 #endif
 #define u8g2_GetBufferPtr(u8g2) ((u8g2)->tile_buf_ptr)
 #define u8g2_GetBufferTileHeight(u8g2)	((u8g2)->tile_buf_height)
@@ -1731,6 +2504,42 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2);
 void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th);
 void u8g2_UpdateDisplay(u8g2_t *u8g2);
 
+#ifdef U8G2_WITH_INCREMENTAL_SEND
+void u8g2_SendBufferBegin(u8g2_t *u8g2);
+uint8_t u8g2_SendBufferStep(u8g2_t *u8g2, uint16_t budget);
+void u8g2_SendBufferDone(u8g2_t *u8g2);
+#define u8g2_IsSendBufferActive(u8g2) ((u8g2)->send_row != 255)
+#endif
+
+#ifdef U8G2_WITH_DIRTY_TILES
+/* size of the dirty tile tracking buffer in bytes: two bits per tile */
+#define u8g2_GetDirtyTileBufferSize(u8g2) ((((u8g2_GetBufferTileWidth(u8g2)+7)>>3)) * 2 * (u8g2)->tile_buf_height)
+/* number of bytes, which were not sent by the last call to u8g2_SendDirtyTiles() */
+#define u8g2_GetDirtyBytesSaved(u8g2) ((u8g2)->dirty_bytes_saved)
+void u8g2_SetDirtyTileBuffer(u8g2_t *u8g2, uint8_t *buf);
+void u8g2_MarkDirtyArea(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_SendDirtyTiles(u8g2_t *u8g2);
+#endif
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+/* send only the changed tiles */
+#define U8G2_SHADOW_MODE_DIFF 0
+/* send all tiles, but count the changed tiles */
+#define U8G2_SHADOW_MODE_COUNT 1
+/* size of the shadow buffer in bytes: always the size of the complete display memory */
+#define u8g2_GetShadowBufferSize(u8g2) ((u8g2)->u8x8.display_info->tile_width * 8 * (u8g2)->u8x8.display_info->tile_height)
+/* changed tiles and compared tiles of the last frame, valid after u8g2_SendBuffer() or the last u8g2_NextPage() */
+#define u8g2_GetChangedTiles(u8g2) ((u8g2)->shadow_changed_tiles)
+#define u8g2_GetFrameTiles(u8g2) ((u8g2)->shadow_frame_tiles)
+void u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t mode);
+uint8_t u8g2_GetChangedTilePercent(u8g2_t *u8g2);
+#endif
+
+#ifdef U8G2_WITH_DISPLAY_LIST
+/* number of bytes used by the last recorded picture loop, if larger than the size of the display list, then the display list was not used */
+#define u8g2_GetDisplayListUsage(u8g2) ((u8g2)->dlist_pos)
+#endif
+
 void u8g2_WriteBufferPBM(u8g2_t *u8g2, void (*out)(const char *s));
 void u8g2_WriteBufferXBM(u8g2_t *u8g2, void (*out)(const char *s));
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
@@ -1738,6 +2547,29 @@ void u8g2_WriteBufferPBM2(u8g2_t *u8g2, void (*out)(const char *s));
 void u8g2_WriteBufferXBM2(u8g2_t *u8g2, void (*out)(const char *s));
 
 
+/*==========================================*/
+/* u8g2_dlist.c */
+
+#ifdef U8G2_WITH_DISPLAY_LIST
+#define U8G2_DLIST_STATE_OFF 0
+#define U8G2_DLIST_STATE_REPLAY 1
+#define U8G2_DLIST_STATE_RECORD 2
+
+void u8g2_SetDisplayList(u8g2_t *u8g2, uint8_t *buf, size_t size);
+
+/* internal procedures, used by the draw procedures during recording */
+#define u8g2_is_dlist_record(u8g2) ((u8g2)->dlist_state == U8G2_DLIST_STATE_RECORD)
+void u8g2_dlist_add_hvline(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_dlist_add_box(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_dlist_add_glyph(u8g2_t *u8g2, const uint8_t *glyph_data, u8g2_uint_t x, u8g2_uint_t y);
+void u8g2_dlist_add_xbm(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+void u8g2_dlist_add_xbmp(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+void u8g2_dlist_add_bitmap_cnt(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt, u8g2_uint_t h, const uint8_t *bitmap);
+void u8g2_dlist_add_clip(u8g2_t *u8g2);
+void u8g2_dlist_start(u8g2_t *u8g2);
+void u8g2_dlist_replay(u8g2_t *u8g2);
+#endif
+
 /*==========================================*/
 /* u8g2_ll_hvline.c */
 /*
@@ -1754,6 +2586,69 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 /* ST7920 */
 void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
 
+#ifdef U8G2_WITH_GRAY_BUFFER
+/* SSD1322, SSD1327, SH1122 gray buffer: 4 or 2 bit per pixel, leftmost pixel in the upper bits */
+void u8g2_ll_hvline_horizontal_gray4(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_ll_hvline_horizontal_gray2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+#endif
+
+#ifdef U8G2_WITH_HVLINE_COLOR_SPECIALIZATION
+/* draw color specific variants: _and_not: draw color 0, _or: draw color 1, _xor: draw color 2 */
+void u8g2_ll_hvline_vertical_top_lsb_and_not(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_ll_hvline_vertical_top_lsb_or(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_ll_hvline_vertical_top_lsb_xor(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_ll_hvline_horizontal_right_lsb_and_not(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_ll_hvline_horizontal_right_lsb_or(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_ll_hvline_horizontal_right_lsb_xor(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+
+/* returns the list of the three draw color specific procedures for ll_hvline_cb or NULL */
+const u8g2_draw_ll_hvline_cb *u8g2_ll_hvline_get_color_list(u8g2_draw_ll_hvline_cb ll_hvline_cb);
+
+/* 
+  returns the ll_hvline procedure for the current draw color. The procedure is 
+  selected for each line, so that draw_color can also be assigned directly.
+*/
+#define u8g2_get_ll_hvline(u8g2) \
+  ( ((u8g2)->ll_hvline_color_list != NULL && (u8g2)->draw_color < 3) ? \
+    (u8g2)->ll_hvline_color_list[(u8g2)->draw_color] : (u8g2)->ll_hvline )
+#else
+#define u8g2_get_ll_hvline(u8g2) ((u8g2)->ll_hvline)
+#endif
+
+#ifdef U8G2_WITH_LL_BOX
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box, both must not be 0
+  assumption: 
+    all clipping done
+*/
+void u8g2_ll_box_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_ll_box_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_ll_box_horizontal_gray4(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_ll_box_horizontal_gray2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+#endif
+
+/* returns the ll_box procedure for the buffer layout of ll_hvline_cb or NULL */
+u8g2_draw_ll_box_cb u8g2_ll_box_get(u8g2_draw_ll_hvline_cb ll_hvline_cb);
+#endif
+
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+/*
+  x,y		Upper left position within the local buffer (not the display!)
+  w,h		width and height of the visible area, both must not be 0
+  bitmap	first visible column of a u8g2_font_bitmap_t bitmap
+  bitmap_y	first visible row of the bitmap
+  Set pixels of the bitmap are drawn with the current draw color (0, 1 or 2).
+  assumption: 
+    all clipping done
+*/
+void u8g2_ll_bitmap_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, u8g2_uint_t bitmap_y, uint8_t bytes_per_column);
+
+/* returns the ll_bitmap procedure for the buffer layout of ll_hvline_cb or NULL */
+u8g2_draw_ll_bitmap_cb u8g2_ll_bitmap_get(u8g2_draw_ll_hvline_cb ll_hvline_cb);
+#endif
+
 
 /*==========================================*/
 /* u8g2_hvline.c */
@@ -1761,12 +2656,31 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
 /* u8g2_DrawHVLine does not use u8g2_IsIntersection */
 void u8g2_DrawHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
 
+#ifdef U8G2_WITH_LL_BOX
+/* internal box procedures, used by u8g2_DrawBox() and the draw_b90 procedures */
+void u8g2_draw_box_clip(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_draw_box_2dir(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+#endif
+
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+/* internal bitmap procedure for the font bitmap cache, requires u8g2->ll_bitmap and U8G2_R0 */
+void u8g2_draw_bitmap_clip(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, uint8_t bytes_per_column);
+#endif
+
 /* the following three function will do an intersection test of this is enabled with U8G2_WITH_INTERSECTION */
 void u8g2_DrawHLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len);
 void u8g2_DrawVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len);
 void u8g2_DrawPixel(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y);
 void u8g2_SetDrawColor(u8g2_t *u8g2, uint8_t color) U8G2_NOINLINE;  /* u8g: u8g_SetColorIndex(u8g_t *u8g, uint8_t idx); */
 
+/* 
+  gray level draw colors 16..31 for level 0 (off) .. 15 (fully on), see U8G2_WITH_GRAY_BUFFER
+  2 bit gray buffers use the upper two bits of the level, monochrome buffers set the 
+  pixel for level 8..15 and clear it for level 0..7
+*/
+#define U8G2_DRAW_COLOR_GRAY(level) (0x10 | ((level) & 0x0f))
+#define u8g2_is_gray_draw_color(color) (((color) & 0xf0) == 0x10)
+
 
 /*==========================================*/
 /* u8g2_bitmap.c */
@@ -1860,6 +2774,9 @@ void u8g2_DrawTriangle(u8g2_t *u8g2, int16_t x0, int16_t y0, int16_t x1, int16_t
 //uint8_t u8g2_GetNullKerning(u8g2_t *u8g2, uint16_t e1, uint16_t e2);
 uint8_t u8g2_GetKerning(u8g2_t *u8g2, u8g2_kerning_t *kerning, uint16_t e1, uint16_t e2);
 uint8_t u8g2_GetKerningByTable(u8g2_t *u8g2, const uint16_t *kt, uint16_t e1, uint16_t e2);
+#ifdef U8G2_WITH_KERNING_CACHE
+void u8g2_SetKerningCache(u8g2_t *u8g2, u8g2_kerning_cache_t *buf, uint8_t cnt);
+#endif
 
 
 /*==========================================*/
@@ -1868,6 +2785,11 @@ uint8_t u8g2_GetKerningByTable(u8g2_t *u8g2, const uint16_t *kt, uint16_t e1, ui
 u8g2_uint_t u8g2_add_vector_y(u8g2_uint_t dy, int8_t x, int8_t y, uint8_t dir) U8G2_NOINLINE;
 u8g2_uint_t u8g2_add_vector_x(u8g2_uint_t dx, int8_t x, int8_t y, uint8_t dir) U8G2_NOINLINE;
 
+#ifdef U8G2_WITH_DISPLAY_LIST
+/* used by the display list: draw a glyph of a specific font, glyph_data NULL will only select the font */
+void u8g2_font_replay_glyph(u8g2_t *u8g2, const uint8_t *font, const uint8_t *glyph_data, u8g2_uint_t x, u8g2_uint_t y);
+#endif
+
 
 size_t u8g2_GetFontSize(const uint8_t *font_arg);
 
@@ -1875,7 +2797,21 @@ size_t u8g2_GetFontSize(const uint8_t *font_arg);
 #define U8G2_FONT_HEIGHT_MODE_XTEXT 1
 #define U8G2_FONT_HEIGHT_MODE_ALL 2
 
+/* type of the glyph offset table, upper bits of byte 1 of the font */
+#define U8G2_FONT_OFFSET_TABLE_DENSE 0x40
+#define U8G2_FONT_OFFSET_TABLE_SPARSE 0x80
+
 void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font);
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+#define U8G2_FONT_GLYPH_INDEX_CNT 256
+void u8g2_SetFontGlyphIndex(u8g2_t *u8g2, uint16_t *buf);
+#endif
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+void u8g2_SetFontGlyphCache(u8g2_t *u8g2, u8g2_font_glyph_cache_t *buf, uint8_t cnt);
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+void u8g2_SetFontBitmapCache(u8g2_t *u8g2, u8g2_font_bitmap_t *buf, uint8_t cnt);
+#endif
 void u8g2_SetFontMode(u8g2_t *u8g2, uint8_t is_transparent);
 
 uint8_t u8g2_IsGlyph(u8g2_t *u8g2, uint16_t requested_encoding);
@@ -1883,6 +2819,7 @@ int8_t u8g2_GetGlyphWidth(u8g2_t *u8g2, uint16_t requested_encoding);
 
 u8g2_uint_t u8g2_DrawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding);
 u8g2_uint_t u8g2_DrawGlyphX2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding);
+u8g2_uint_t u8g2_DrawGlyphScaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, uint16_t encoding);
 int8_t u8g2_GetStrX(u8g2_t *u8g2, const char *s);	/* for u8g compatibility, WARNING: use u8g2_GetGlyphXOffset() instead! */
 int8_t u8g2_GetXOffsetGlyph(u8g2_t *u8g2, uint16_t encoding);
 int8_t u8g2_GetXOffsetUTF8(u8g2_t *u8g2, const char *utf8);
@@ -1890,8 +2827,10 @@ int8_t u8g2_GetXOffsetUTF8(u8g2_t *u8g2, const char *utf8);
 void u8g2_SetFontDirection(u8g2_t *u8g2, uint8_t dir);
 u8g2_uint_t u8g2_DrawStr(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str);
 u8g2_uint_t u8g2_DrawStrX2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str);
+u8g2_uint_t u8g2_DrawStrScaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, const char *str);
 u8g2_uint_t u8g2_DrawUTF8(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str);
 u8g2_uint_t u8g2_DrawUTF8X2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str);
+u8g2_uint_t u8g2_DrawUTF8Scaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, const char *str);
 u8g2_uint_t u8g2_DrawExtendedUTF8(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t to_left, u8g2_kerning_t *kerning, const char *str);
 u8g2_uint_t u8g2_DrawExtUTF8(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t to_left, const uint16_t *kerning_table, const char *str);
 
@@ -1907,6 +2846,11 @@ uint8_t u8g2_IsAllValidUTF8(u8g2_t *u8g2, const char *str);	// checks whether al
 u8g2_uint_t u8g2_GetStrWidth(u8g2_t *u8g2, const char *s);
 u8g2_uint_t u8g2_GetUTF8Width(u8g2_t *u8g2, const char *str);
 /*u8g2_uint_t u8g2_GetExactStrWidth(u8g2_t *u8g2, const char *s);*/ /*obsolete, see also https://github.com/olikraus/u8g2/issues/1561 */
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+void u8g2_SetStrWidthCache(u8g2_t *u8g2, u8g2_str_width_cache_t *buf, uint8_t cnt);
+#define u8g2_GetStrWidthCacheHitCnt(u8g2) ((u8g2)->str_width_cache_hit_cnt)
+#define u8g2_GetStrWidthCacheMissCnt(u8g2) ((u8g2)->str_width_cache_miss_cnt)
+#endif
 
 
 void u8g2_SetFontPosBaseline(u8g2_t *u8g2);
@@ -92,6 +92,13 @@ void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_is_dlist_record(u8g2) )
+  {
+    u8g2_dlist_add_bitmap_cnt(u8g2, x, y, cnt, h, bitmap);
+    return;
+  }
+#endif
   
   while( h > 0 )
   {
@@ -174,6 +181,13 @@ void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_is_dlist_record(u8g2) )
+  {
+    u8g2_dlist_add_xbm(u8g2, x, y, w, h, bitmap);
+    return;
+  }
+#endif
   
   while( h > 0 )
   {
@@ -262,6 +276,13 @@ void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_is_dlist_record(u8g2) )
+  {
+    u8g2_dlist_add_xbmp(u8g2, x, y, w, h, bitmap);
+    return;
+  }
+#endif
   
   while( h > 0 )
   {
@@ -45,6 +45,20 @@ void u8g2_DrawBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_is_dlist_record(u8g2) )
+  {
+    u8g2_dlist_add_box(u8g2, x, y, w, h);
+    return;
+  }
+#endif
+#ifdef U8G2_WITH_LL_BOX
+  if ( u8g2->cb->draw_b90 != NULL )
+  {
+    u8g2_draw_box_clip(u8g2, x, y, w, h);	/* clip once, then fill the box in the buffer */
+    return;
+  }
+#endif
   while( h != 0 )
   { 
     u8g2_DrawHVLine(u8g2, x, y, w, 0);
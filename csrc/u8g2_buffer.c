@@ -40,10 +40,25 @@
 void u8g2_ClearBuffer(u8g2_t *u8g2)
 {
   size_t cnt;
-  cnt = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  cnt = u8g2_GetBufferTileRowSize(u8g2);
   cnt *= u8g2->tile_buf_height;
-  cnt *= 8;
   memset(u8g2->tile_buf_ptr, 0, cnt);
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_buf != NULL )
+  {
+    uint8_t *dirty, *drawn;
+    /* tiles, which had been drawn since the last clear, will change now */
+    cnt = u8g2_GetDirtyTileBufferSize(u8g2)/2;
+    dirty = u8g2->dirty_tile_buf;
+    drawn = dirty + cnt;
+    while( cnt > 0 )
+    {
+      *dirty++ |= *drawn;
+      *drawn++ = 0;
+      cnt--;
+    }
+  }
+#endif
 }
 
 /*============================================*/
@@ -51,18 +66,132 @@ void u8g2_ClearBuffer(u8g2_t *u8g2)
 static void u8g2_send_tile_row(u8g2_t *u8g2, uint8_t src_tile_row, uint8_t dest_tile_row)
 {
   uint8_t *ptr;
-  uint16_t offset;
+  size_t offset;
   uint8_t w;
   
   w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
   offset = src_tile_row;
   ptr = u8g2->tile_buf_ptr;
-  offset *= w;
-  offset *= 8;
+  offset *= u8g2_GetBufferTileRowSize(u8g2);
   ptr += offset;
+#ifdef U8G2_WITH_GRAY_BUFFER
+  if ( u8g2->bits_per_pixel > 1 )
+  {
+    u8x8_DrawGrayTile(u8g2_GetU8x8(u8g2), 0, dest_tile_row, w, u8g2->bits_per_pixel, ptr);
+    return;				/* the shadow buffer is only used for monochrome buffers */
+  }
+#endif
   u8x8_DrawTile(u8g2_GetU8x8(u8g2), 0, dest_tile_row, w, ptr);
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  if ( u8g2->shadow_buf != NULL )
+    memcpy(u8g2->shadow_buf + (size_t)dest_tile_row*w*8, ptr, (uint16_t)w*8);	/* keep the shadow buffer in sync */
+#endif
+}
+
+#if defined(U8G2_WITH_DIRTY_TILES) || defined(U8G2_WITH_SHADOW_BUFFER) || defined(U8G2_WITH_INCREMENTAL_SEND)
+/*
+  Partial tile rows can be sent only for the vertical_top_lsb memory architecture,
+  other controller procedures expect complete tile rows.
+*/
+static uint8_t u8g2_is_vertical_top_lsb(u8g2_t *u8g2)
+{
+  return u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb;
+}
+
+#endif
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+
+/* compare one tile (8 bytes) of the vertical_top_lsb buffer, two 32 bit words at a time */
+static uint8_t u8g2_is_tile_changed(const uint8_t *a, const uint8_t *b)
+{
+  uint32_t a0, a1, b0, b1;
+  memcpy(&a0, a, 4);
+  memcpy(&a1, a+4, 4);
+  memcpy(&b0, b, 4);
+  memcpy(&b1, b+4, 4);
+  return ((a0^b0)|(a1^b1)) != 0;
+}
+
+/*
+  Same as u8g2_send_tile_row, but compare the tile row with the shadow buffer.
+  Only runs of changed tiles are sent, unless the shadow buffer is not yet valid or
+  the mode is U8G2_SHADOW_MODE_COUNT.
+  For displays without the vertical_top_lsb memory architecture, the complete tile row is 
+  sent if any tile has changed.
+*/
+static void u8g2_send_changed_tile_row(u8g2_t *u8g2, uint8_t src_tile_row, uint8_t dest_tile_row)
+{
+  uint8_t *ptr;
+  uint8_t *shadow;
+  size_t offset;
+  uint8_t w, tx, tw, i;
+  uint8_t changed;
+  uint8_t is_send_all;
+  
+  w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  offset = src_tile_row;
+  offset *= w;
+  offset *= 8;
+  ptr = u8g2->tile_buf_ptr + offset;
+  offset = dest_tile_row;
+  offset *= w;
+  offset *= 8;
+  shadow = u8g2->shadow_buf + offset;
+  
+  is_send_all = 0;
+  if ( u8g2->is_shadow_valid == 0 || u8g2->shadow_mode == U8G2_SHADOW_MODE_COUNT )
+    is_send_all = 1;
+  
+  changed = 0;
+  if ( u8g2_is_vertical_top_lsb(u8g2) )
+  {
+    tx = 0;
+    while( tx < w )
+    {
+      if ( u8g2_is_tile_changed(ptr+tx*8, shadow+tx*8) == 0 )
+      {
+	tx++;
+	continue;
+      }
+      /* find the end of the run of changed tiles */
+      tw = 1;
+      while( tx+tw < w && u8g2_is_tile_changed(ptr+(tx+tw)*8, shadow+(tx+tw)*8) != 0 )
+	tw++;
+      if ( is_send_all == 0 )
+	u8x8_DrawTile(u8g2_GetU8x8(u8g2), tx, dest_tile_row, tw, ptr+tx*8);
+      changed += tw;
+      tx += tw;
+    }
+  }
+  else
+  {
+    /* tiles are not continuous in memory, compare all 8 lines of each tile */
+    for( tx = 0; tx < w; tx++ )
+    {
+      for( i = 0; i < 8; i++ )
+      {
+	if ( ptr[i*w+tx] != shadow[i*w+tx] )
+	{
+	  changed++;
+	  break;
+	}
+      }
+    }
+    if ( changed != 0 )
+      is_send_all = 1;
+  }
+  
+  if ( is_send_all != 0 )
+    u8x8_DrawTile(u8g2_GetU8x8(u8g2), 0, dest_tile_row, w, ptr);
+  
+  memcpy(shadow, ptr, (uint16_t)w*8);
+  u8g2->shadow_changed_tiles += changed;
+  u8g2->shadow_frame_tiles += w;
 }
 
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+
 /* 
   write the buffer to the display RAM. 
   For most displays, this will make the content visible to the user.
@@ -81,12 +210,44 @@ static void u8g2_send_buffer(u8g2_t *u8g2)
   dest_row = u8g2->tile_curr_row;
   dest_max = u8g2_GetU8x8(u8g2)->display_info->tile_height;
   
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  if ( dest_row == 0 )
+  {
+    /* first page of a new frame */
+    u8g2->shadow_changed_tiles = 0;
+    u8g2->shadow_frame_tiles = 0;
+  }
+#endif
+  
+#ifdef U8G2_WITH_FULL_FRAME_UPLOAD
+  /* a full frame buffer is sent with one message, if the display supports this */
+  if ( dest_row == 0 && src_max >= dest_max && u8g2_GetBufferBitsPerPixel(u8g2) == 1 && u8g2_GetU8x8(u8g2)->is_full_frame != 0
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    && u8g2->shadow_buf == NULL
+#endif
+    )
+  {
+    if ( u8x8_DrawFullFrame(u8g2_GetU8x8(u8g2), u8g2->tile_buf_ptr) != 0 )
+      return;
+  }
+#endif
+  
   do
   {
-    u8g2_send_tile_row(u8g2, src_row, dest_row);
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    if ( u8g2->shadow_buf != NULL && u8g2_GetBufferBitsPerPixel(u8g2) == 1 )
+      u8g2_send_changed_tile_row(u8g2, src_row, dest_row);
+    else
+#endif
+      u8g2_send_tile_row(u8g2, src_row, dest_row);
     src_row++;
     dest_row++;
   } while( src_row < src_max && dest_row < dest_max );
+  
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  if ( dest_row >= dest_max )
+    u8g2->is_shadow_valid = 1;		/* the complete display memory is now known */
+#endif
 }
 
 /* same as u8g2_send_buffer but also send the DISPLAY_REFRESH message (used by SSD1606) */
@@ -96,6 +257,117 @@ void u8g2_SendBuffer(u8g2_t *u8g2)
   u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );  
 }
 
+/*============================================*/
+/* incremental send */
+
+#ifdef U8G2_WITH_INCREMENTAL_SEND
+/*
+  Description:
+    Same as u8g2_SendBuffer(), but the buffer is sent in several steps:
+      u8g2_SendBufferBegin(&u8g2);
+      while( u8g2_SendBufferStep(&u8g2, 16) )
+        other_tasks();
+      u8g2_SendBufferDone(&u8g2);
+    The position is stored in the u8g2 object. The buffer must not be modified
+    before u8g2_SendBufferStep() has returned 0, the display must not be 
+    accessed with other procedures in between.
+    In page mode, the current page is sent.
+*/
+void u8g2_SendBufferBegin(u8g2_t *u8g2)
+{
+  u8g2->send_row = 0;
+  u8g2->send_tx = 0;
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  if ( u8g2->tile_curr_row == 0 )
+  {
+    /* first page of a new frame */
+    u8g2->shadow_changed_tiles = 0;
+    u8g2->shadow_frame_tiles = 0;
+  }
+#endif
+}
+
+/*
+  Description:
+    Send up to "budget" tiles (8 bytes each for monochrome buffers). 
+    Partial tile rows are only sent to controllers with the vertical_top_lsb 
+    memory architecture, for other controllers and with a shadow buffer a 
+    complete tile row is sent, even if this exceeds the budget. At least one
+    tile or tile row is sent.
+  Return:
+    1 if there are tiles left, 0 if the complete buffer has been sent.
+*/
+uint8_t u8g2_SendBufferStep(u8g2_t *u8g2, uint16_t budget)
+{
+  uint8_t w, dest_row, tw;
+  uint8_t is_partial;
+  uint8_t *ptr;
+  
+  w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  is_partial = u8g2_is_vertical_top_lsb(u8g2) && u8g2_GetBufferBitsPerPixel(u8g2) == 1;
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  if ( u8g2->shadow_buf != NULL )
+    is_partial = 0;
+#endif
+  if ( budget == 0 )
+    budget = 1;
+  
+  for(;;)
+  {
+    if ( u8g2->send_row >= u8g2->tile_buf_height )
+      break;
+    dest_row = u8g2->tile_curr_row + u8g2->send_row;
+    if ( dest_row >= u8g2_GetU8x8(u8g2)->display_info->tile_height )
+      break;
+    if ( budget == 0 )
+      return 1;
+    
+    if ( is_partial )
+    {
+      tw = w - u8g2->send_tx;
+      if ( tw > budget )
+	tw = budget;
+      ptr = u8g2->tile_buf_ptr + ((size_t)u8g2->send_row*w + u8g2->send_tx)*8;
+      u8x8_DrawTile(u8g2_GetU8x8(u8g2), u8g2->send_tx, dest_row, tw, ptr);
+      budget -= tw;
+      u8g2->send_tx += tw;
+      if ( u8g2->send_tx < w )
+	continue;
+    }
+    else
+    {
+#ifdef U8G2_WITH_SHADOW_BUFFER
+      if ( u8g2->shadow_buf != NULL && u8g2_GetBufferBitsPerPixel(u8g2) == 1 )
+	u8g2_send_changed_tile_row(u8g2, u8g2->send_row, dest_row);
+      else
+#endif
+	u8g2_send_tile_row(u8g2, u8g2->send_row, dest_row);
+      budget = budget > w ? budget - w : 0;
+    }
+    u8g2->send_tx = 0;
+    u8g2->send_row++;
+  }
+  
+  if ( u8g2->send_row != 255 )
+  {
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    if ( u8g2->tile_curr_row + u8g2->send_row >= u8g2_GetU8x8(u8g2)->display_info->tile_height )
+      u8g2->is_shadow_valid = 1;		/* the complete display memory is now known */
+#endif
+    u8g2->send_row = 255;
+  }
+  return 0;
+}
+
+/* send the remaining tiles and the DISPLAY_REFRESH message */
+void u8g2_SendBufferDone(u8g2_t *u8g2)
+{
+  while( u8g2_SendBufferStep(u8g2, 0xffff) != 0 )
+    ;
+  u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );  
+}
+#endif /* U8G2_WITH_INCREMENTAL_SEND */
+
 /*============================================*/
 void u8g2_SetBufferCurrTileRow(u8g2_t *u8g2, uint8_t row)
 {
@@ -111,11 +383,59 @@ void u8g2_FirstPage(u8g2_t *u8g2)
     u8g2_ClearBuffer(u8g2);
   }
   u8g2_SetBufferCurrTileRow(u8g2, 0);
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2->dlist_buf != NULL )
+    u8g2_dlist_start(u8g2);		/* record the first pass of the picture loop */
+#endif
 }
 
+#ifdef U8G2_WITH_DISPLAY_LIST
+/*
+  Called by u8g2_NextPage() after the recording pass of the picture loop.
+  If the display list is complete, then replay it for all pages and return 0.
+  Otherwise return 1, the picture loop continues without display list, 
+  starting again with the first page.
+*/
+static uint8_t u8g2_dlist_next_page(u8g2_t *u8g2)
+{
+  uint8_t row;
+  
+  if ( u8g2->dlist_pos > u8g2->dlist_size )
+  {
+    /* display list is too small, restore the page window */
+    u8g2->dlist_state = U8G2_DLIST_STATE_OFF;
+    u8g2_SetBufferCurrTileRow(u8g2, 0);
+    return 1;
+  }
+  
+  u8g2->dlist_state = U8G2_DLIST_STATE_REPLAY;
+  row = 0;
+  for(;;)
+  {
+    u8g2_SetBufferCurrTileRow(u8g2, row);
+    u8g2_dlist_replay(u8g2);
+    u8g2_send_buffer(u8g2);
+    row += u8g2->tile_buf_height;
+    if ( row >= u8g2_GetU8x8(u8g2)->display_info->tile_height )
+      break;
+    if ( u8g2->is_auto_page_clear )
+    {
+      u8g2_ClearBuffer(u8g2);
+    }
+  }
+  u8g2->dlist_state = U8G2_DLIST_STATE_OFF;
+  u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );
+  return 0;
+}
+#endif /* U8G2_WITH_DISPLAY_LIST */
+
 uint8_t u8g2_NextPage(u8g2_t *u8g2)
 {
   uint8_t row;
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_is_dlist_record(u8g2) )
+    return u8g2_dlist_next_page(u8g2);
+#endif
   u8g2_send_buffer(u8g2);
   row = u8g2->tile_curr_row;
   row += u8g2->tile_buf_height;
@@ -152,28 +472,237 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2)
 */
 void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th)
 {
-  uint16_t page_size;
+  size_t page_size;
   uint8_t *ptr;
   
   /* check, whether we are in full buffer mode */
   if ( u8g2->tile_buf_height != u8g2_GetU8x8(u8g2)->display_info->tile_height )
     return; /* not in full buffer mode, do nothing */
 
-  page_size = u8g2->pixel_buf_width;  /* 8*u8g2->u8g2_GetU8x8(u8g2)->display_info->tile_width */
+  page_size = u8g2_GetBufferTileRowSize(u8g2);  /* 8*u8g2->u8g2_GetU8x8(u8g2)->display_info->tile_width for monochrome buffers */
     
   ptr = u8g2_GetBufferPtr(u8g2);
-  ptr += tx*8;
   ptr += page_size*ty;
   
+#ifdef U8G2_WITH_GRAY_BUFFER
+  if ( u8g2->bits_per_pixel > 1 )
+  {
+    /* one tile has bits_per_pixel bytes in each pixel row */
+    ptr += tx*u8g2->bits_per_pixel;
+    while( th > 0 )
+    {
+      u8x8_DrawGrayTile(u8g2_GetU8x8(u8g2), tx, ty, tw, u8g2->bits_per_pixel, ptr);
+      ptr += page_size;
+      ty++;
+      th--;
+    }
+    return;
+  }
+#endif
+  
+  ptr += tx*8;
   while( th > 0 )
   {
     u8x8_DrawTile( u8g2_GetU8x8(u8g2), tx, ty, tw, ptr );
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    if ( u8g2->shadow_buf != NULL )
+      memcpy(u8g2->shadow_buf + (ptr - u8g2_GetBufferPtr(u8g2)), ptr, (uint16_t)tw*8);	/* keep the shadow buffer in sync */
+#endif
     ptr += page_size;
     ty++;
     th--;
   }  
 }
 
+/*============================================*/
+/* dirty tile tracking */
+
+#ifdef U8G2_WITH_DIRTY_TILES
+
+/*
+  Description:
+    Assign a memory area for the dirty tile tracking. The size of the memory 
+    area must be u8g2_GetDirtyTileBufferSize(u8g2) bytes. All tiles are marked as dirty,
+    because the content of the display is unknown.
+    A NULL pointer will disable the dirty tile tracking.
+    
+  Layout of buf:
+    For each tile row there are (tile_width+7)/8 bytes, one bit per tile, lsb is the left tile.
+    The first half of buf contains the dirty tiles (modified since the last u8g2_SendDirtyTiles()),
+    the second half contains the drawn tiles (modified since the last u8g2_ClearBuffer()).
+*/
+void u8g2_SetDirtyTileBuffer(u8g2_t *u8g2, uint8_t *buf)
+{
+  u8g2->dirty_tile_buf = buf;
+  u8g2->dirty_bytes_saved = 0;
+  if ( buf != NULL )
+  {
+    memset(buf, 0x0ff, u8g2_GetDirtyTileBufferSize(u8g2));
+  }
+}
+
+/*
+  Description:
+    Mark all tiles of the given pixel area as dirty. Called by the hvline procedures.
+    This procedure can also be called by the user after writing to the buffer directly.
+  Args:
+    x, y	Upper left position of the area within the local buffer (not the display!)
+    w, h	Size of the area in pixel, must not be 0
+  Assumption:
+    all clipping done
+*/
+void u8g2_MarkDirtyArea(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint8_t *dirty;
+  uint16_t half;
+  uint8_t row_size;
+  uint8_t tx, tx0, tx1, ty, ty1;
+  uint8_t mask;
+  
+  if ( u8g2->dirty_tile_buf == NULL )
+    return;
+  
+  tx0 = x >> 3;
+  tx1 = (x+w-1) >> 3;
+  ty = y >> 3;
+  ty1 = (y+h-1) >> 3;
+  
+  row_size = (u8g2_GetBufferTileWidth(u8g2)+7)>>3;
+  half = row_size;
+  half *= u8g2->tile_buf_height;
+  
+  for(;;)
+  {
+    dirty = u8g2->dirty_tile_buf;
+    dirty += (uint16_t)ty*row_size;
+    for( tx = tx0; tx <= tx1; tx++ )
+    {
+      mask = 1;
+      mask <<= tx & 7;
+      dirty[tx>>3] |= mask;
+      dirty[half + (tx>>3)] |= mask;
+    }
+    if ( ty >= ty1 )
+      break;
+    ty++;
+  }
+}
+
+/*
+  Description:
+    Same as u8g2_SendBuffer(), but only send the tiles, which have been modified since the
+    last call to this procedure. Dirty tiles of a tile row are sent as horizontal runs 
+    with u8g2_UpdateDisplayArea().
+    The number of bytes not sent is available with u8g2_GetDirtyBytesSaved().
+    
+  Limitations:
+    - Only available in full buffer mode, u8g2_SendBuffer() is used otherwise
+    - The dirty tile buffer must be assigned with u8g2_SetDirtyTileBuffer()
+    - Complete tile rows are sent for displays without the vertical_top_lsb memory architecture
+      (gray buffers are sent tile by tile, see u8g2_SetupGrayBuffer())
+*/
+void u8g2_SendDirtyTiles(u8g2_t *u8g2)
+{
+  uint8_t *dirty;
+  uint8_t tile_width;
+  uint8_t row_size;
+  uint8_t tx, ty, tw;
+  uint8_t is_partial;
+  uint8_t tile_size;
+  uint32_t saved;
+  
+  tile_width = u8g2_GetBufferTileWidth(u8g2);
+  if ( u8g2->dirty_tile_buf == NULL || u8g2->tile_buf_height != u8g2_GetU8x8(u8g2)->display_info->tile_height )
+  {
+    u8g2_SendBuffer(u8g2);
+    return;
+  }
+
+  is_partial = u8g2_is_vertical_top_lsb(u8g2);
+  tile_size = 8*u8g2_GetBufferBitsPerPixel(u8g2);	/* bytes per tile */
+#ifdef U8G2_WITH_GRAY_BUFFER
+  if ( u8g2->bits_per_pixel > 1 )
+    is_partial = 1;
+#endif
+  row_size = (tile_width+7)>>3;
+  dirty = u8g2->dirty_tile_buf;
+  saved = 0;
+  for( ty = 0; ty < u8g2->tile_buf_height; ty++ )
+  {
+    tx = 0;
+    while( tx < tile_width )
+    {
+      /* skip clean tiles */
+      if ( (dirty[tx>>3] & (1<<(tx&7))) == 0 )
+      {
+	saved += tile_size;
+	tx++;
+	continue;
+      }
+      /* find the end of the run of dirty tiles */
+      tw = 1;
+      while( tx+tw < tile_width && (dirty[(tx+tw)>>3] & (1<<((tx+tw)&7))) != 0 )
+	tw++;
+      if ( is_partial == 0 )
+      {
+	/* send the complete tile row */
+	saved = saved - (uint32_t)tx*tile_size;
+	u8g2_send_tile_row(u8g2, ty, ty);
+	break;
+      }
+      u8g2_UpdateDisplayArea(u8g2, tx, ty, tw, 1);
+      tx += tw;
+    }
+    memset(dirty, 0, row_size);
+    dirty += row_size;
+  }
+  u8g2->dirty_bytes_saved = saved;
+  u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );  
+}
+
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+/*============================================*/
+/* shadow buffer */
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+
+/*
+  Description:
+    Assign a copy of the display memory. The size of the memory area must be 
+    u8g2_GetShadowBufferSize(u8g2) bytes (also in page mode). 
+    A NULL pointer will disable the shadow buffer.
+    The first frame after this call is always sent completely. Call this procedure 
+    again, if the display memory was modified without u8g2 (e.g. by u8x8 procedures).
+  Args:
+    mode	U8G2_SHADOW_MODE_DIFF: Only send changed tiles
+		U8G2_SHADOW_MODE_COUNT: Send all tiles, only count the changed tiles
+*/
+void u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t mode)
+{
+  u8g2->shadow_buf = buf;
+  u8g2->shadow_mode = mode;
+  u8g2->is_shadow_valid = 0;
+  u8g2->shadow_changed_tiles = 0;
+  u8g2->shadow_frame_tiles = 0;
+}
+
+/* percentage (0..100) of the changed tiles of the last frame */
+uint8_t u8g2_GetChangedTilePercent(u8g2_t *u8g2)
+{
+  uint32_t p;
+  if ( u8g2->shadow_frame_tiles == 0 )
+    return 0;
+  p = u8g2->shadow_changed_tiles;
+  p *= 100;
+  p /= u8g2->shadow_frame_tiles;
+  return p;
+}
+
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+
+/*============================================*/
+
 /* same as sendBuffer, but does not send the ePaper refresh message */
 void u8g2_UpdateDisplay(u8g2_t *u8g2)
 {
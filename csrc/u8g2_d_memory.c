@@ -432,6 +432,84 @@ uint8_t *u8g2_m_32_8_f(uint8_t *page_cnt)
   return buf;
   #endif
 }
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g4_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[1024];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g4_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[2048];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g4_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 8;
+  return 0;
+  #else
+  static uint8_t buf[8192];
+  *page_cnt = 8;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g2_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[512];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g2_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[1024];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_32_8_g2_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 8;
+  return 0;
+  #else
+  static uint8_t buf[4096];
+  *page_cnt = 8;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 uint8_t *u8g2_m_13_8_1(uint8_t *page_cnt)
 {
   #ifdef U8G2_USE_DYNAMIC_ALLOC
@@ -729,6 +807,318 @@ uint8_t *u8g2_m_12_8_f(uint8_t *page_cnt)
   return buf;
   #endif
 }
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g4_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[384];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g4_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[768];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g4_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 8;
+  return 0;
+  #else
+  static uint8_t buf[3072];
+  *page_cnt = 8;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g2_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[192];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g2_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[384];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_8_g2_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 8;
+  return 0;
+  #else
+  static uint8_t buf[1536];
+  *page_cnt = 8;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g4_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[384];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g4_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[768];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g4_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 12;
+  return 0;
+  #else
+  static uint8_t buf[4608];
+  *page_cnt = 12;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g2_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[192];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g2_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[384];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_12_12_g2_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 12;
+  return 0;
+  #else
+  static uint8_t buf[2304];
+  *page_cnt = 12;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g4_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[512];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g4_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[1024];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g4_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 16;
+  return 0;
+  #else
+  static uint8_t buf[8192];
+  *page_cnt = 16;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g2_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[256];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g2_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[512];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_16_g2_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 16;
+  return 0;
+  #else
+  static uint8_t buf[4096];
+  *page_cnt = 16;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g4_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[512];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g4_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[1024];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g4_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 12;
+  return 0;
+  #else
+  static uint8_t buf[6144];
+  *page_cnt = 12;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g2_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[256];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g2_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[512];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_16_12_g2_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 12;
+  return 0;
+  #else
+  static uint8_t buf[3072];
+  *page_cnt = 12;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 uint8_t *u8g2_m_16_5_1(uint8_t *page_cnt)
 {
   #ifdef U8G2_USE_DYNAMIC_ALLOC
@@ -1818,6 +2208,84 @@ uint8_t *u8g2_m_20_17_f(uint8_t *page_cnt)
   return buf;
   #endif
 }
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g4_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[960];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g4_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[1920];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g4_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 16;
+  return 0;
+  #else
+  static uint8_t buf[15360];
+  *page_cnt = 16;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g2_1(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 1;
+  return 0;
+  #else
+  static uint8_t buf[480];
+  *page_cnt = 1;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g2_2(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 2;
+  return 0;
+  #else
+  static uint8_t buf[960];
+  *page_cnt = 2;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+#ifdef U8G2_WITH_GRAY_BUFFER
+uint8_t *u8g2_m_30_16_g2_f(uint8_t *page_cnt)
+{
+  #ifdef U8G2_USE_DYNAMIC_ALLOC
+  *page_cnt = 16;
+  return 0;
+  #else
+  static uint8_t buf[7680];
+  *page_cnt = 16;
+  return buf;
+  #endif
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 uint8_t *u8g2_m_26_5_1(uint8_t *page_cnt)
 {
   #ifdef U8G2_USE_DYNAMIC_ALLOC
@@ -1483,6 +1483,72 @@ void u8g2_Setup_sh1122_256x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_ms
   buf = u8g2_m_32_8_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_horizontal_right_lsb, rotation);
 }
+/* sh1122 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* sh1122 */
 /* sh1122 1 */
 void u8g2_Setup_sh1122_i2c_256x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -1511,6 +1577,72 @@ void u8g2_Setup_sh1122_i2c_256x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x
   buf = u8g2_m_32_8_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_horizontal_right_lsb, rotation);
 }
+/* sh1122 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* sh1122 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_sh1122_i2c_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_sh1122_256x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1306 */
 /* ssd1306 1 */
 void u8g2_Setup_ssd1306_128x32_univision_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -2739,6 +2871,72 @@ void u8g2_Setup_ssd1327_ws_96x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8
   buf = u8g2_m_12_8_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ws_96x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1327 */
 /* ssd1327 1 */
 void u8g2_Setup_ssd1327_i2c_ws_96x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -2767,6 +2965,72 @@ void u8g2_Setup_ssd1327_i2c_ws_96x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation,
   buf = u8g2_m_12_8_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ws_96x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_96x64, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_8_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1327 */
 /* ssd1327 1 */
 void u8g2_Setup_ssd1327_seeed_96x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -2795,6 +3059,72 @@ void u8g2_Setup_ssd1327_seeed_96x96_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u
   buf = u8g2_m_12_12_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_seeed_96x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1327 */
 /* ssd1327 1 */
 void u8g2_Setup_ssd1327_i2c_seeed_96x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -2823,6 +3153,72 @@ void u8g2_Setup_ssd1327_i2c_seeed_96x96_f(u8g2_t *u8g2, const u8g2_cb_t *rotatio
   buf = u8g2_m_12_12_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_seeed_96x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_seeed_96x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_12_12_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1327 */
 /* ssd1327 1 */
 void u8g2_Setup_ssd1327_ea_w128128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -2866,163 +3262,583 @@ void u8g2_Setup_ssd1327_ea_w128128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8
   buf = u8g2_m_16_16_2(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
-void u8g2_Setup_ssd1327_midas_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_midas_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_2(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_2(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_2(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+/* ssd1327 f */
+void u8g2_Setup_ssd1327_ea_w128128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_midas_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_midas_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_midas_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_midas_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_midas_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_midas_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_ea_w128128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_midas_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_zjy_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1327_ws_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 */
+/* ssd1327 1 */
+void u8g2_Setup_ssd1327_i2c_ea_w128128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_1(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_midas_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_1(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_1(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_ws_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_1(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+/* ssd1327 2 */
+void u8g2_Setup_ssd1327_i2c_ea_w128128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_2(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_midas_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_2(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_2(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_ws_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_2(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+/* ssd1327 f */
+void u8g2_Setup_ssd1327_i2c_ea_w128128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_midas_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_ws_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_f(&tile_buf_height);
+  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+}
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
-  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_2(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
 }
-void u8g2_Setup_ssd1327_zjy_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
-  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_2(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
 }
-void u8g2_Setup_ssd1327_ws_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
-  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_2(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
 }
-/* ssd1327 f */
-void u8g2_Setup_ssd1327_ea_w128128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
-  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
 }
-void u8g2_Setup_ssd1327_midas_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
-  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
 }
-void u8g2_Setup_ssd1327_zjy_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
-  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
 }
-void u8g2_Setup_ssd1327_ws_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
-  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
 }
-/* ssd1327 */
-/* ssd1327 1 */
-void u8g2_Setup_ssd1327_i2c_ea_w128128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_1(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_midas_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_1(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_zjy_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_1(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_ws_128x128_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_1(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-/* ssd1327 2 */
-void u8g2_Setup_ssd1327_i2c_ea_w128128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_2(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_midas_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_2(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_zjy_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_2(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_ws_128x128_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_2(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-/* ssd1327 f */
-void u8g2_Setup_ssd1327_i2c_ea_w128128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_ea_w128128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ea_w128128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_midas_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_midas_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_midas_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_zjy_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_zjy_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_zjy_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
-void u8g2_Setup_ssd1327_i2c_ws_128x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+void u8g2_Setup_ssd1327_i2c_ws_128x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
 {
   uint8_t tile_buf_height;
   uint8_t *buf;
   u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_ws_128x128, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
-  buf = u8g2_m_16_16_f(&tile_buf_height);
-  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
+  buf = u8g2_m_16_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
 }
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1327 */
 /* ssd1327 1 */
 void u8g2_Setup_ssd1327_visionox_128x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -3051,6 +3867,72 @@ void u8g2_Setup_ssd1327_visionox_128x96_f(u8g2_t *u8g2, const u8g2_cb_t *rotatio
   buf = u8g2_m_16_12_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_visionox_128x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_001, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1327 */
 /* ssd1327 1 */
 void u8g2_Setup_ssd1327_i2c_visionox_128x96_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -3079,6 +3961,72 @@ void u8g2_Setup_ssd1327_i2c_visionox_128x96_f(u8g2_t *u8g2, const u8g2_cb_t *rot
   buf = u8g2_m_16_12_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1327 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1327 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1327_i2c_visionox_128x96_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1327_visionox_128x96, u8x8_cad_ssd13xx_i2c, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_16_12_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1329 */
 /* ssd1329 1 */
 void u8g2_Setup_ssd1329_128x96_noname_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -8267,6 +9215,120 @@ void u8g2_Setup_ssd1322_topwin_240x128_f(u8g2_t *u8g2, const u8g2_cb_t *rotation
   buf = u8g2_m_30_16_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1322 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1322_topwin_240x128_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_topwin_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1322_topwin_240x128_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_topwin_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1322_topwin_240x128_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_topwin_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1322_topwin_240x128_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_topwin_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1322_topwin_240x128_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_topwin_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_240x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1322_topwin_240x128_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_topwin_240x128, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_30_16_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1322 */
 /* ssd1322 1 */
 void u8g2_Setup_ssd1322_nhd_256x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -8319,6 +9381,120 @@ void u8g2_Setup_ssd1322_zjy_256x64_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8
   buf = u8g2_m_32_8_f(&tile_buf_height);
   u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_vertical_top_lsb, rotation);
 }
+/* ssd1322 g4_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_nhd_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1322_zjy_256x64_g4_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_zjy_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g4_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_nhd_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1322_zjy_256x64_g4_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_zjy_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g4_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_nhd_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+void u8g2_Setup_ssd1322_zjy_256x64_g4_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_zjy_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g4_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 4, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g2_1 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_nhd_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1322_zjy_256x64_g2_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_zjy_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_1(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g2_2 */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_nhd_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1322_zjy_256x64_g2_2(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_zjy_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_2(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
+/* ssd1322 g2_f */
+#ifdef U8G2_WITH_GRAY_BUFFER
+void u8g2_Setup_ssd1322_nhd_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_nhd_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+void u8g2_Setup_ssd1322_zjy_256x64_g2_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
+{
+  uint8_t tile_buf_height;
+  uint8_t *buf;
+  u8g2_SetupDisplay(u8g2, u8x8_d_ssd1322_zjy_256x64, u8x8_cad_011, byte_cb, gpio_and_delay_cb);
+  buf = u8g2_m_32_8_g2_f(&tile_buf_height);
+  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, 2, rotation);
+}
+#endif /* U8G2_WITH_GRAY_BUFFER */
 /* ssd1322 */
 /* ssd1322 1 */
 void u8g2_Setup_ssd1322_nhd_128x64_1(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb)
@@ -0,0 +1,388 @@
+/*
+
+  u8g2_dlist.c
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Copyright (c) 2026, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+
+
+  Display list for the page buffer mode.
+  
+  Without display list, the application has to execute all draw procedures
+  for each page of the display (picture loop). With display list, the first pass 
+  of the picture loop records the draw procedures into a memory area, provided 
+  by the user. u8g2_NextPage() will then replay the recorded procedures for all 
+  pages and the picture loop is executed only once.
+  
+    uint8_t dlist_buf[512];
+    u8g2_SetDisplayList(&u8g2, dlist_buf, sizeof(dlist_buf));
+    u8g2_FirstPage(&u8g2);
+    do
+    {
+      draw();
+    } while( u8g2_NextPage(&u8g2) );
+    
+  If the display list is too small, u8g2_NextPage() will continue with the 
+  usual picture loop. The required size is returned by u8g2_GetDisplayListUsage().
+  
+  Recorded procedures:
+    hvline	all graphics procedures, which are based on u8g2_DrawHVLine()
+    box		u8g2_DrawBox()
+    glyph	reference to the glyph data of the current font
+    bitmap	reference to the bitmap data of u8g2_DrawXBM(), u8g2_DrawXBMP() and u8g2_DrawBitmap()
+    clip		clip window changes
+  Glyphs and bitmaps are drawn again for each page, but only if they intersect with the page.
+  
+  Limitations:
+    - The referenced bitmaps and strings must not be changed during the picture loop
+    - The display rotation must not be changed within the picture loop
+    - Direct modifications of the page buffer are not recorded
+
+*/
+
+#include "u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_DISPLAY_LIST
+
+/* upper nibble of the first byte of a display list entry */
+#define U8G2_DLIST_CMD_HVLINE 0x10
+#define U8G2_DLIST_CMD_BOX 0x20
+#define U8G2_DLIST_CMD_GLYPH 0x30
+#define U8G2_DLIST_CMD_XBM 0x40
+#define U8G2_DLIST_CMD_XBMP 0x50
+#define U8G2_DLIST_CMD_BITMAP 0x60
+#define U8G2_DLIST_CMD_CLIP 0x70
+#define U8G2_DLIST_CMD_COLOR 0x80
+
+/*
+  lower nibble of the first byte:
+    bit 0..1: draw color, 3: the color of the last color entry (gray level color)
+    bit 2..3: hvline: direction (0..3)
+	      glyph: bit 2: font direction bit 0, bit 3: font direction bit 1
+	      bitmaps: bit 2: bitmap transparency
+  glyph: font transparency is stored in an extra byte
+  color: the draw color is stored in an extra byte
+*/
+
+/*===============================================*/
+/* record */
+
+/*
+  Allocate "size" bytes in the display list and write the first byte.
+  Returns NULL if there is not enough memory. The display list position is 
+  always advanced, so that the required size is known after the first pass.
+*/
+static uint8_t *u8g2_dlist_alloc(u8g2_t *u8g2, uint8_t cmd, size_t size)
+{
+  uint8_t *ptr;
+  size_t pos = u8g2->dlist_pos;
+  
+  size++;
+  if ( pos + size < pos )
+    return NULL;	/* overflow of the position */
+  u8g2->dlist_pos = pos + size;
+  if ( pos + size > u8g2->dlist_size )
+    return NULL;
+  ptr = u8g2->dlist_buf + pos;
+  *ptr++ = cmd;
+  return ptr;
+}
+
+static uint8_t *u8g2_dlist_put_uint(uint8_t *ptr, u8g2_uint_t v)
+{
+  memcpy(ptr, &v, sizeof(u8g2_uint_t));
+  return ptr + sizeof(u8g2_uint_t);
+}
+
+static uint8_t *u8g2_dlist_put_ptr(uint8_t *ptr, const uint8_t *p)
+{
+  memcpy(ptr, &p, sizeof(const uint8_t *));
+  return ptr + sizeof(const uint8_t *);
+}
+
+/*
+  Return the draw color for the lower bits of the first byte. Gray level colors 
+  do not fit into two bits, they are recorded as a separate color entry.
+*/
+static uint8_t u8g2_dlist_color(u8g2_t *u8g2, uint8_t color)
+{
+  uint8_t *ptr;
+  if ( color < 3 )
+    return color;
+  ptr = u8g2_dlist_alloc(u8g2, U8G2_DLIST_CMD_COLOR, 1);
+  if ( ptr != NULL )
+    *ptr = color;
+  return 3;
+}
+
+/* called by u8g2_SetClipWindow() and u8g2_SetMaxClipWindow() */
+void u8g2_dlist_add_clip(u8g2_t *u8g2)
+{
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  uint8_t *ptr = u8g2_dlist_alloc(u8g2, U8G2_DLIST_CMD_CLIP, 4*sizeof(u8g2_uint_t));
+  if ( ptr != NULL )
+  {
+    ptr = u8g2_dlist_put_uint(ptr, u8g2->clip_x0);
+    ptr = u8g2_dlist_put_uint(ptr, u8g2->clip_y0);
+    ptr = u8g2_dlist_put_uint(ptr, u8g2->clip_x1);
+    u8g2_dlist_put_uint(ptr, u8g2->clip_y1);
+  }
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+}
+
+/* called by u8g2_DrawHVLine() after clipping, dir is 0 or 1 */
+void u8g2_dlist_add_hvline(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  uint8_t *ptr = u8g2_dlist_alloc(u8g2, U8G2_DLIST_CMD_HVLINE | u8g2_dlist_color(u8g2, u8g2->draw_color) | (dir << 2), 3*sizeof(u8g2_uint_t));
+  if ( ptr != NULL )
+  {
+    ptr = u8g2_dlist_put_uint(ptr, x);
+    ptr = u8g2_dlist_put_uint(ptr, y);
+    u8g2_dlist_put_uint(ptr, len);
+  }
+}
+
+/* called by u8g2_DrawBox() */
+void u8g2_dlist_add_box(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint8_t *ptr = u8g2_dlist_alloc(u8g2, U8G2_DLIST_CMD_BOX | u8g2_dlist_color(u8g2, u8g2->draw_color), 4*sizeof(u8g2_uint_t));
+  if ( ptr != NULL )
+  {
+    ptr = u8g2_dlist_put_uint(ptr, x);
+    ptr = u8g2_dlist_put_uint(ptr, y);
+    ptr = u8g2_dlist_put_uint(ptr, w);
+    u8g2_dlist_put_uint(ptr, h);
+  }
+}
+
+/* 
+  called by u8g2_font_decode_glyph(), x and y are the glyph reference position (u8g2->font_decode.target_x/y 
+  before decoding the glyph)
+*/
+void u8g2_dlist_add_glyph(u8g2_t *u8g2, const uint8_t *glyph_data, u8g2_uint_t x, u8g2_uint_t y)
+{
+  uint8_t cmd = U8G2_DLIST_CMD_GLYPH | u8g2_dlist_color(u8g2, u8g2->font_decode.fg_color);
+  uint8_t *ptr;
+#ifdef U8G2_WITH_FONT_ROTATION
+  cmd |= u8g2->font_decode.dir << 2;
+#endif
+  ptr = u8g2_dlist_alloc(u8g2, cmd, 1 + 2*sizeof(const uint8_t *) + 2*sizeof(u8g2_uint_t));
+  if ( ptr != NULL )
+  {
+    *ptr++ = u8g2->font_decode.is_transparent;
+    ptr = u8g2_dlist_put_ptr(ptr, u8g2->font);
+    ptr = u8g2_dlist_put_ptr(ptr, glyph_data);
+    ptr = u8g2_dlist_put_uint(ptr, x);
+    u8g2_dlist_put_uint(ptr, y);
+  }
+}
+
+/* called by u8g2_DrawXBM(), u8g2_DrawXBMP() and u8g2_DrawBitmap(), cmd is U8G2_DLIST_CMD_XBM, _XBMP or _BITMAP */
+static void u8g2_dlist_add_bitmap(u8g2_t *u8g2, uint8_t cmd, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  uint8_t *ptr = u8g2_dlist_alloc(u8g2, cmd | u8g2_dlist_color(u8g2, u8g2->draw_color) | (u8g2->bitmap_transparency << 2), 4*sizeof(u8g2_uint_t) + sizeof(const uint8_t *));
+  if ( ptr != NULL )
+  {
+    ptr = u8g2_dlist_put_uint(ptr, x);
+    ptr = u8g2_dlist_put_uint(ptr, y);
+    ptr = u8g2_dlist_put_uint(ptr, w);
+    ptr = u8g2_dlist_put_uint(ptr, h);
+    u8g2_dlist_put_ptr(ptr, bitmap);
+  }
+}
+
+void u8g2_dlist_add_xbm(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  u8g2_dlist_add_bitmap(u8g2, U8G2_DLIST_CMD_XBM, x, y, w, h, bitmap);
+}
+
+void u8g2_dlist_add_xbmp(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  u8g2_dlist_add_bitmap(u8g2, U8G2_DLIST_CMD_XBMP, x, y, w, h, bitmap);
+}
+
+void u8g2_dlist_add_bitmap_cnt(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  u8g2_dlist_add_bitmap(u8g2, U8G2_DLIST_CMD_BITMAP, x, y, cnt, h, bitmap);
+}
+
+/*
+  Called by u8g2_FirstPage(): Start recording. The page window is extended to the 
+  complete display, so that no procedure is skipped by the intersection test.
+  Nothing is written into the page buffer while recording.
+*/
+void u8g2_dlist_start(u8g2_t *u8g2)
+{
+  u8g2_uint_t t;
+  
+  u8g2->dlist_state = U8G2_DLIST_STATE_RECORD;
+  u8g2->dlist_pos = 0;
+  u8g2_dlist_add_clip(u8g2);	/* clip window at the beginning of the picture loop */
+  
+  t = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+  t *= 8;
+  u8g2->buf_y0 = 0;
+  u8g2->buf_y1 = t;
+  u8g2->cb->update_page_win(u8g2);
+}
+
+/*===============================================*/
+/* replay */
+
+static const uint8_t *u8g2_dlist_get_uint(const uint8_t *ptr, u8g2_uint_t *v)
+{
+  memcpy(v, ptr, sizeof(u8g2_uint_t));
+  return ptr + sizeof(u8g2_uint_t);
+}
+
+static const uint8_t *u8g2_dlist_get_ptr(const uint8_t *ptr, const uint8_t **p)
+{
+  memcpy(p, ptr, sizeof(const uint8_t *));
+  return ptr + sizeof(const uint8_t *);
+}
+
+/*
+  Called by u8g2_NextPage(): Draw all entries of the display list into the current page.
+  Entries, which do not intersect with the current page, are skipped by the 
+  intersection test of the draw procedures.
+  The state of u8g2 (draw color, font, font mode, bitmap mode) is restored afterwards.
+*/
+void u8g2_dlist_replay(u8g2_t *u8g2)
+{
+  const uint8_t *ptr = u8g2->dlist_buf;
+  const uint8_t *end = ptr + u8g2->dlist_pos;
+  const uint8_t *font = u8g2->font;
+  const uint8_t *glyph_font;
+  const uint8_t *p;
+  uint8_t draw_color = u8g2->draw_color;
+  uint8_t gray_color = draw_color;
+  uint8_t is_transparent = u8g2->font_decode.is_transparent;
+  uint8_t bitmap_transparency = u8g2->bitmap_transparency;
+#ifdef U8G2_WITH_FONT_ROTATION
+  uint8_t dir = u8g2->font_decode.dir;
+#endif
+  uint8_t cmd;
+  u8g2_uint_t x, y, w, h;
+  
+  while( ptr < end )
+  {
+    cmd = *ptr++;
+    if ( (cmd & 3) == 3 )
+      u8g2->draw_color = gray_color;
+    else
+      u8g2->draw_color = cmd & 3;
+    switch( cmd & 0x0f0 )
+    {
+      case U8G2_DLIST_CMD_HVLINE:
+	ptr = u8g2_dlist_get_uint(ptr, &x);
+	ptr = u8g2_dlist_get_uint(ptr, &y);
+	ptr = u8g2_dlist_get_uint(ptr, &w);
+	u8g2_DrawHVLine(u8g2, x, y, w, (cmd >> 2) & 3);
+	break;
+      case U8G2_DLIST_CMD_BOX:
+	ptr = u8g2_dlist_get_uint(ptr, &x);
+	ptr = u8g2_dlist_get_uint(ptr, &y);
+	ptr = u8g2_dlist_get_uint(ptr, &w);
+	ptr = u8g2_dlist_get_uint(ptr, &h);
+	u8g2_DrawBox(u8g2, x, y, w, h);
+	break;
+      case U8G2_DLIST_CMD_GLYPH:
+	u8g2->font_decode.is_transparent = *ptr++;
+#ifdef U8G2_WITH_FONT_ROTATION
+	u8g2->font_decode.dir = (cmd >> 2) & 3;
+#endif
+	ptr = u8g2_dlist_get_ptr(ptr, &glyph_font);
+	ptr = u8g2_dlist_get_ptr(ptr, &p);
+	ptr = u8g2_dlist_get_uint(ptr, &x);
+	ptr = u8g2_dlist_get_uint(ptr, &y);
+	u8g2_font_replay_glyph(u8g2, glyph_font, p, x, y);
+	break;
+      case U8G2_DLIST_CMD_XBM:
+      case U8G2_DLIST_CMD_XBMP:
+      case U8G2_DLIST_CMD_BITMAP:
+	u8g2->bitmap_transparency = (cmd >> 2) & 1;
+	ptr = u8g2_dlist_get_uint(ptr, &x);
+	ptr = u8g2_dlist_get_uint(ptr, &y);
+	ptr = u8g2_dlist_get_uint(ptr, &w);
+	ptr = u8g2_dlist_get_uint(ptr, &h);
+	ptr = u8g2_dlist_get_ptr(ptr, &p);
+	if ( (cmd & 0x0f0) == U8G2_DLIST_CMD_XBM )
+	  u8g2_DrawXBM(u8g2, x, y, w, h, p);
+	else if ( (cmd & 0x0f0) == U8G2_DLIST_CMD_XBMP )
+	  u8g2_DrawXBMP(u8g2, x, y, w, h, p);
+	else
+	  u8g2_DrawBitmap(u8g2, x, y, w, h, p);
+	break;
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+      case U8G2_DLIST_CMD_CLIP:
+	ptr = u8g2_dlist_get_uint(ptr, &(u8g2->clip_x0));
+	ptr = u8g2_dlist_get_uint(ptr, &(u8g2->clip_y0));
+	ptr = u8g2_dlist_get_uint(ptr, &(u8g2->clip_x1));
+	ptr = u8g2_dlist_get_uint(ptr, &(u8g2->clip_y1));
+	u8g2->cb->update_page_win(u8g2);
+	break;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+      case U8G2_DLIST_CMD_COLOR:
+	gray_color = *ptr++;
+	break;
+      default:
+	ptr = end;	/* corrupt display list */
+	break;
+    }
+  }
+  
+  /* restore the state of u8g2 */
+  u8g2_font_replay_glyph(u8g2, font, NULL, 0, 0);
+  u8g2->font_decode.is_transparent = is_transparent;
+  u8g2->bitmap_transparency = bitmap_transparency;
+#ifdef U8G2_WITH_FONT_ROTATION
+  u8g2->font_decode.dir = dir;
+#endif
+  u8g2->draw_color = draw_color;
+}
+
+/*===============================================*/
+/* user interface */
+
+/*
+  Description:
+    Assign a memory area for the display list. The display list is used
+    by the next call to u8g2_FirstPage(). 
+    A NULL pointer will disable the display list.
+*/
+void u8g2_SetDisplayList(u8g2_t *u8g2, uint8_t *buf, size_t size)
+{
+  u8g2->dlist_buf = buf;
+  u8g2->dlist_size = size;
+  u8g2->dlist_pos = 0;
+  u8g2->dlist_state = U8G2_DLIST_STATE_OFF;
+}
+
+#endif /* U8G2_WITH_DISPLAY_LIST */
@@ -34,6 +34,7 @@
 */
 
 #include "u8g2.h"
+#include <string.h>
 
 /* size of the font data structure, there is no struct or class... */
 /* this is the size for the new font format */
@@ -45,6 +46,7 @@
   offset	bytes	description
   0		1		glyph_cnt		number of glyphs
   1		1		bbx_mode	0: proportional, 1: common height, 2: monospace, 3: multiple of 8
+					bit 6/7: type of the glyph offset table (0x40: dense, 0x80: sparse)
   2		1		bits_per_0	glyph rle parameter
   3		1		bits_per_1	glyph rle parameter
 
@@ -73,6 +75,18 @@
   21		1		start pos unicode high byte
   22		1		start pos unicode low byte
 
+  Optional glyph offset table (bdfconv option -i), if bit 6 or 7 of byte 1 is set:
+  23		2		size of the offset table, the glyphs start at offset 23 + size
+  25		2		number of entries
+  dense:
+  27		2		encoding of the first entry
+  29		3*n		offset of the glyph for each encoding, 0x0ffffff: glyph does not exist
+  sparse:
+  27		5*n		encoding (2 bytes) and offset (3 bytes) for each glyph, sorted by encoding
+  
+  All offsets (also the start positions above) are relative to the first glyph.
+  Without offset table, the first glyph starts at offset 23.
+
   Font build mode, 0: proportional, 1: common height, 2: monospace, 3: multiple of 8
 
   Font build mode 0:		
@@ -132,7 +146,7 @@ void u8g2_read_font_info(u8g2_font_info_t *font_info, const uint8_t *font)
 {
   /* offset 0 */
   font_info->glyph_cnt = u8g2_font_get_byte(font, 0);
-  font_info->bbx_mode = u8g2_font_get_byte(font, 1);
+  font_info->bbx_mode = u8g2_font_get_byte(font, 1) & 0x3f;
   font_info->bits_per_0 = u8g2_font_get_byte(font, 2);
   font_info->bits_per_1 = u8g2_font_get_byte(font, 3);
   
@@ -163,6 +177,12 @@ void u8g2_read_font_info(u8g2_font_info_t *font_info, const uint8_t *font)
 #ifdef U8G2_WITH_UNICODE
   font_info->start_pos_unicode = u8g2_font_get_word(font, 21); 
 #endif
+
+  /* offset 23 */
+  font_info->offset_table_type = u8g2_font_get_byte(font, 1) & 0xc0;
+  font_info->offset_table_size = 0;
+  if ( font_info->offset_table_type != 0 )
+    font_info->offset_table_size = u8g2_font_get_word(font, 23);
 }
 
 
@@ -172,6 +192,8 @@ size_t u8g2_GetFontSize(const uint8_t *font_arg)
   uint16_t e;
   const uint8_t *font = font_arg;
   font += U8G2_FONT_DATA_STRUCT_SIZE;
+  if ( (u8g2_font_get_byte(font_arg, 1) & 0xc0) != 0 )
+    font += u8g2_font_get_word(font, 0);		/* skip the glyph offset table */
   
   for(;;)
   {
@@ -292,6 +314,97 @@ int8_t u8g2_font_decode_get_signed_bits(u8g2_font_decode_t *f, uint8_t cnt)
 }
 
 
+/*
+  Run length decoder for the glyph bitmap: The glyph bitmap is a sequence of
+  tuples: 0-run (bits_per_0), 1-run (bits_per_1), followed by a sequence of 
+  repeat bits. A repeat bit 1 will repeat the 0-run and 1-run once more.
+  With U8G2_WITH_FONT_BIT_RESERVOIR, the bits are collected in a 32 bit 
+  reservoir. The reservoir is filled byte by byte only up to the bits of the 
+  next tuple, so the decoder never reads beyond the glyph data.
+*/
+struct _u8g2_font_rle_t
+{
+#ifdef U8G2_WITH_FONT_BIT_RESERVOIR
+  const uint8_t *ptr;		/* next byte for the reservoir */
+  uint32_t bits;		/* reservoir, LSB is the next bit */
+  uint8_t cnt;			/* number of bits in the reservoir */
+  uint8_t bits_per_0;
+  uint8_t bits_per_1;
+  uint8_t bits_per_tuple;		/* bits_per_0 + bits_per_1 + 1 */
+  uint8_t mask_0;
+  uint8_t mask_1;
+#else
+  u8g2_font_decode_t *decode;
+  uint8_t bits_per_0;
+  uint8_t bits_per_1;
+#endif
+};
+typedef struct _u8g2_font_rle_t u8g2_font_rle_t;
+
+/* continue with the glyph data at the current position of u8g2->font_decode */
+static void u8g2_font_rle_start(u8g2_t *u8g2, u8g2_font_rle_t *rle)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+#ifdef U8G2_WITH_FONT_BIT_RESERVOIR
+  rle->ptr = decode->decode_ptr;
+  rle->bits = u8x8_pgm_read( rle->ptr ) >> decode->decode_bit_pos;
+  rle->cnt = 8 - decode->decode_bit_pos;
+  rle->ptr++;
+  rle->bits_per_0 = u8g2->font_info.bits_per_0;
+  rle->bits_per_1 = u8g2->font_info.bits_per_1;
+  rle->bits_per_tuple = u8g2->font_info.bits_per_0 + u8g2->font_info.bits_per_1 + 1;
+  rle->mask_0 = (1U<<u8g2->font_info.bits_per_0)-1;
+  rle->mask_1 = (1U<<u8g2->font_info.bits_per_1)-1;
+#else
+  rle->decode = decode;
+  rle->bits_per_0 = u8g2->font_info.bits_per_0;
+  rle->bits_per_1 = u8g2->font_info.bits_per_1;
+#endif
+}
+
+#ifdef U8G2_WITH_FONT_BIT_RESERVOIR
+static U8G2_ALWAYS_INLINE void u8g2_font_rle_fill(u8g2_font_rle_t *rle, uint8_t cnt)
+{
+  while( rle->cnt < cnt )
+  {
+    rle->bits |= (uint32_t)u8x8_pgm_read( rle->ptr ) << rle->cnt;
+    rle->ptr++;
+    rle->cnt += 8;
+  }
+}
+#endif
+
+/* get the 0-run (a) and the 1-run (b) of the next tuple */
+static U8G2_ALWAYS_INLINE void u8g2_font_rle_get_tuple(u8g2_font_rle_t *rle, uint8_t *a, uint8_t *b)
+{
+#ifdef U8G2_WITH_FONT_BIT_RESERVOIR
+  u8g2_font_rle_fill(rle, rle->bits_per_tuple);		/* includes the first repeat bit */
+  *a = rle->bits & rle->mask_0;
+  rle->bits >>= rle->bits_per_0;
+  *b = rle->bits & rle->mask_1;
+  rle->bits >>= rle->bits_per_1;
+  rle->cnt -= rle->bits_per_tuple - 1;
+#else
+  *a = u8g2_font_decode_get_unsigned_bits(rle->decode, rle->bits_per_0);
+  *b = u8g2_font_decode_get_unsigned_bits(rle->decode, rle->bits_per_1);
+#endif
+}
+
+/* get the next repeat bit */
+static U8G2_ALWAYS_INLINE uint8_t u8g2_font_rle_get_repeat(u8g2_font_rle_t *rle)
+{
+#ifdef U8G2_WITH_FONT_BIT_RESERVOIR
+  uint8_t r;
+  u8g2_font_rle_fill(rle, 1);
+  r = rle->bits & 1;
+  rle->bits >>= 1;
+  rle->cnt--;
+  return r;
+#else
+  return u8g2_font_decode_get_unsigned_bits(rle->decode, 1);
+#endif
+}
+
 #ifdef U8G2_WITH_FONT_ROTATION
 u8g2_uint_t u8g2_add_vector_y(u8g2_uint_t dy, int8_t x, int8_t y, uint8_t dir)
 {
@@ -481,13 +594,73 @@ void u8g2_font_decode_len(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground)
   decode->y = ly;  
 }
 
+#ifdef U8G2_WITH_FONT_DIR_DECODE
+/*
+  Description:
+    Same as u8g2_font_decode_len(), but for a fixed direction.
+    (ux,uy) is the screen vector for one step in glyph x direction, 
+    (vx,vy) is the screen vector for one step in glyph y direction.
+    The target position is calculated once and then updated for each new glyph line.
+*/
+#define U8G2_FONT_DECODE_LEN_DIR(name, dir, ux, uy, vx, vy) \
+static void name(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground) \
+{ \
+  u8g2_font_decode_t *decode = &(u8g2->font_decode); \
+  uint8_t cnt = len; \
+  uint8_t rem, current; \
+  uint8_t lx = decode->x; \
+  uint8_t ly = decode->y; \
+  u8g2_uint_t x, y; \
+  \
+  x = decode->target_x + (ux)*lx + (vx)*ly; \
+  y = decode->target_y + (uy)*lx + (vy)*ly; \
+  if ( is_foreground ) \
+    u8g2->draw_color = decode->fg_color; \
+  else if ( decode->is_transparent == 0 ) \
+    u8g2->draw_color = decode->bg_color; \
+  for(;;) \
+  { \
+    rem = decode->glyph_width; \
+    rem -= lx; \
+    current = rem; \
+    if ( cnt < rem ) \
+      current = cnt; \
+    if ( is_foreground || decode->is_transparent == 0 ) \
+      u8g2_DrawHVLine(u8g2, x, y, current, dir); \
+    if ( cnt < rem ) \
+      break; \
+    cnt -= rem; \
+    /* move to the start of the next glyph line */ \
+    x -= (ux)*lx; \
+    y -= (uy)*lx; \
+    x += (vx); \
+    y += (vy); \
+    lx = 0; \
+    ly++; \
+  } \
+  decode->x = lx + cnt; \
+  decode->y = ly; \
+}
+
+U8G2_FONT_DECODE_LEN_DIR(u8g2_font_decode_len_dir0, 0, 1, 0, 0, 1)
+U8G2_FONT_DECODE_LEN_DIR(u8g2_font_decode_len_dir1, 1, 0, 1, -1, 0)
+U8G2_FONT_DECODE_LEN_DIR(u8g2_font_decode_len_dir2, 2, -1, 0, 0, -1)
+U8G2_FONT_DECODE_LEN_DIR(u8g2_font_decode_len_dir3, 3, 0, -1, 1, 0)
+#endif /* U8G2_WITH_FONT_DIR_DECODE */
 
-void u8g2_font_2x_decode_len(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground)
+
+/*
+  Description:
+    Run length draw procedure for u8g2_DrawGlyphScaled(): Each pixel of the glyph
+    is drawn as decode->scale x decode->scale block.
+*/
+void u8g2_font_scaled_decode_len(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground)
 {
   uint8_t cnt;	/* total number of remaining pixels, which have to be drawn */
   uint8_t rem; 	/* remaining pixel to the right edge of the glyph */
   uint8_t current;	/* number of pixels, which need to be drawn for the draw procedure */
     /* current is either equal to cnt or equal to rem */
+  uint8_t i;
   
   /* local coordinates of the glyph */
   uint8_t lx,ly;
@@ -496,6 +669,7 @@ void u8g2_font_2x_decode_len(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground)
   u8g2_uint_t x, y;
   
   u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  uint8_t scale = decode->scale;
   
   cnt = len;
   
@@ -515,49 +689,26 @@ void u8g2_font_2x_decode_len(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground)
     if ( cnt < rem )
       current = cnt;
     
-    
-    /* now draw the line, but apply the rotation around the glyph target position */
-    //u8g2_font_decode_draw_pixel(u8g2, lx,ly,current, is_foreground);
-
     /* get target position */
     x = decode->target_x;
     y = decode->target_y;
 
-    x += lx*2;
-    y += ly*2;
+    x += lx*scale;
+    y += ly*scale;
     
     /* draw foreground and background (if required) */
-    if ( is_foreground )
-    {
-      u8g2->draw_color = decode->fg_color;			/* draw_color will be restored later */
-      u8g2_DrawHVLine(u8g2, 
-	x, 
-	y, 
-	current*2, 
-	0
-      );
-      u8g2_DrawHVLine(u8g2, 
-	x, 
-	y+1, 
-	current*2, 
-	0
-      );
-    }
-    else if ( decode->is_transparent == 0 )    
+    if ( is_foreground || decode->is_transparent == 0 )
     {
-      u8g2->draw_color = decode->bg_color;			/* draw_color will be restored later */
-      u8g2_DrawHVLine(u8g2, 
-	x, 
-	y, 
-	current*2, 
-	0
-      );   
-      u8g2_DrawHVLine(u8g2, 
-	x, 
-	y+1, 
-	current*2, 
-	0
-      );   
+      u8g2->draw_color = is_foreground ? decode->fg_color : decode->bg_color;	/* draw_color will be restored later */
+      for( i = 0; i < scale; i++ )
+      {
+	u8g2_DrawHVLine(u8g2, 
+	  x, 
+	  y+i, 
+	  current*scale, 
+	  0
+	);
+      }
     }
     
     /* check, whether the end of the run length code has been reached */
@@ -592,8 +743,214 @@ static void u8g2_font_setup_decode(u8g2_t *u8g2, const uint8_t *glyph_data)
   
   decode->fg_color = u8g2->draw_color;
   decode->bg_color = (decode->fg_color == 0 ? 1 : 0);
+  
+#ifdef U8G2_WITH_FONT_DIR_DECODE
+  switch(decode->dir)
+  {
+    case 0: decode->decode_len = u8g2_font_decode_len_dir0; break;
+    case 1: decode->decode_len = u8g2_font_decode_len_dir1; break;
+    case 2: decode->decode_len = u8g2_font_decode_len_dir2; break;
+    default: decode->decode_len = u8g2_font_decode_len_dir3; break;
+  }
+#endif
+}
+
+
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+/*
+  Description:
+    Assign memory for the bitmap cache of decoded glyphs. If the cache is full, 
+    the least recently used glyph is replaced. A NULL pointer will disable the cache.
+    
+    u8g2_font_bitmap_t font_bitmap_cache[16];
+    u8g2_SetFontBitmapCache(&u8g2, font_bitmap_cache, 16);
+*/
+void u8g2_SetFontBitmapCache(u8g2_t *u8g2, u8g2_font_bitmap_t *buf, uint8_t cnt)
+{
+  uint8_t i;
+  u8g2->font_bitmap_cache = buf;
+  u8g2->font_bitmap_cache_cnt = cnt;
+  if ( buf != NULL )
+    for( i = 0; i < cnt; i++ )
+      buf[i].glyph_data = NULL;
+}
+
+/*
+  Description:
+    Decode the remaining glyph data into a bitmap (see u8g2_font_bitmap_t).
+    The bitmap must be cleared before.
+*/
+static void u8g2_font_decode_bitmap(u8g2_t *u8g2, uint8_t *bitmap, uint8_t bytes_per_column)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  uint8_t a, b, i;
+  uint8_t lx, ly;
+  uint8_t w = decode->glyph_width;
+  uint8_t h = decode->glyph_height;
+  u8g2_font_rle_t rle;
+  
+  lx = 0;
+  ly = 0;
+  u8g2_font_rle_start(u8g2, &rle);
+  for(;;)
+  {
+    u8g2_font_rle_get_tuple(&rle, &a, &b);
+    do
+    {
+      /* skip the background pixel */
+      for( i = a; i > 0; i-- )
+      {
+	lx++;
+	if ( lx >= w )
+	{
+	  lx = 0;
+	  ly++;
+	}
+      }
+      /* set the foreground pixel */
+      for( i = b; i > 0; i-- )
+      {
+	if ( ly < h )
+	  bitmap[lx*bytes_per_column + (ly>>3)] |= 1 << (ly & 7);
+	lx++;
+	if ( lx >= w )
+	{
+	  lx = 0;
+	  ly++;
+	}
+      }
+    } while( u8g2_font_rle_get_repeat(&rle) != 0 );
+
+    if ( ly >= h )
+      break;
+  }
+}
+
+/*
+  Description:
+    Return the decoded bitmap of the glyph. The bitmap is taken from the cache
+    or the glyph is decoded into the least recently used cache entry.
+    u8g2_font_setup_decode() and the glyph header must have been read before.
+  Return:
+    Bitmap or NULL, if the glyph is too large for the cache.
+*/
+static const uint8_t *u8g2_font_get_bitmap(u8g2_t *u8g2, const uint8_t *glyph_data, uint8_t bytes_per_column)
+{
+  u8g2_font_bitmap_t *c = u8g2->font_bitmap_cache;
+  u8g2_font_bitmap_t *lru = c;
+  uint16_t age, lru_age;
+  uint16_t clock;
+  uint8_t i;
+  
+  if ( u8g2->font_bitmap_cache_cnt == 0 )
+    return NULL;
+  if ( (uint16_t)bytes_per_column * (uint8_t)u8g2->font_decode.glyph_width > U8G2_FONT_BITMAP_SIZE )
+    return NULL;
+  
+  clock = ++u8g2->font_bitmap_cache_clock;
+  if ( (clock & 0x3fff) == 0 )
+  {
+    /* 
+      The age is calculated modulo 2^16: Limit the age of old entries to 0x8000 every 0x4000
+      accesses, so that the age of a used entry is always below 0xc000 and does not wrap around.
+    */
+    for( i = 0; i < u8g2->font_bitmap_cache_cnt; i++ )
+      if ( (uint16_t)(clock - c[i].last_use) > 0x8000 )
+	c[i].last_use = clock - 0x8000;
+  }
+  lru_age = 0;
+  for( i = 0; i < u8g2->font_bitmap_cache_cnt; i++ )
+  {
+    if ( c->glyph_data == glyph_data )
+    {
+      c->last_use = clock;
+      return c->bitmap;
+    }
+    if ( c->glyph_data == NULL )
+      age = 0x0ffff;		/* prefer unused entries */
+    else
+      age = (uint16_t)(clock - c->last_use);
+    if ( age > lru_age )
+    {
+      lru_age = age;
+      lru = c;
+    }
+    c++;
+  }
+  
+  lru->glyph_data = glyph_data;
+  lru->last_use = clock;
+  memset(lru->bitmap, 0, U8G2_FONT_BITMAP_SIZE);
+  u8g2_font_decode_bitmap(u8g2, lru->bitmap, bytes_per_column);
+  return lru->bitmap;
 }
 
+/*
+  Description:
+    Draw the glyph from the decoded bitmap. The bitmap is copied 
+    directly into the buffer if possible, otherwise each column is drawn 
+    with u8g2_DrawHVLine().
+    u8g2->font_decode.target_x/y is the upper left corner of the glyph.
+*/
+static void u8g2_font_draw_bitmap(u8g2_t *u8g2, const uint8_t *bitmap, uint8_t bytes_per_column)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  uint8_t lx, ly, len, is_foreground;
+  u8g2_uint_t x, y;
+  uint8_t dir = 0;
+  
+#ifdef U8G2_WITH_FONT_ROTATION
+  dir = decode->dir;
+#endif
+
+  if ( u8g2->ll_bitmap != NULL && u8g2->cb->draw_l90 == u8g2_draw_l90_r0 && dir == 0 )
+  {
+    /* the background of the solid mode is drawn first, this does not work for XOR */
+    if ( decode->is_transparent == 0 && decode->fg_color < 2 )
+    {
+      u8g2->draw_color = decode->bg_color;
+      u8g2_DrawBox(u8g2, decode->target_x, decode->target_y, decode->glyph_width, decode->glyph_height);
+      u8g2->draw_color = decode->fg_color;
+      u8g2_draw_bitmap_clip(u8g2, decode->target_x, decode->target_y, decode->glyph_width, decode->glyph_height, bitmap, bytes_per_column);
+      return;
+    }
+    if ( decode->is_transparent != 0 )
+    {
+      u8g2_draw_bitmap_clip(u8g2, decode->target_x, decode->target_y, decode->glyph_width, decode->glyph_height, bitmap, bytes_per_column);
+      return;
+    }
+  }
+  
+  /* draw each column of the glyph as a sequence of foreground and background lines */
+  for( lx = 0; lx < decode->glyph_width; lx++ )
+  {
+    ly = 0;
+    while( ly < decode->glyph_height )
+    {
+      is_foreground = (bitmap[ly>>3] >> (ly&7)) & 1;
+      len = 1;
+      while( ly + len < decode->glyph_height && ((bitmap[(ly+len)>>3] >> ((ly+len)&7)) & 1) == is_foreground )
+	len++;
+      if ( is_foreground || decode->is_transparent == 0 )
+      {
+	x = decode->target_x;
+	y = decode->target_y;
+#ifdef U8G2_WITH_FONT_ROTATION
+	x = u8g2_add_vector_x(x, lx, ly, dir);
+	y = u8g2_add_vector_y(y, lx, ly, dir);
+#else
+	x += lx;
+	y += ly;
+#endif
+	u8g2->draw_color = is_foreground ? decode->fg_color : decode->bg_color;
+	u8g2_DrawHVLine(u8g2, x, y, len, (dir+1)&3);
+      }
+      ly += len;
+    }
+    bitmap += bytes_per_column;
+  }
+}
+#endif /* U8G2_WITH_FONT_BITMAP_CACHE */
 
 /*
   Description:
@@ -608,10 +965,119 @@ static void u8g2_font_setup_decode(u8g2_t *u8g2, const uint8_t *glyph_data)
   Calls:
     u8g2_font_decode_len()
 */
+#ifdef U8G2_WITH_FONT_SOLID_BOX
+/*
+  Description:
+    Calculate the cell of the glyph on the screen. The cell is the 
+    area, which is covered by the foreground and background runs.
+    u8g2->font_decode.target_x/y must be the upper left corner of 
+    the glyph (as calculated by u8g2_font_decode_glyph()).
+*/
+static void u8g2_font_get_glyph_cell(u8g2_font_decode_t *decode, u8g2_uint_t *x, u8g2_uint_t *y, u8g2_uint_t *w, u8g2_uint_t *h)
+{
+  u8g2_uint_t gw = decode->glyph_width;
+  u8g2_uint_t gh = decode->glyph_height;
+  *x = decode->target_x;
+  *y = decode->target_y;
+  *w = gw;
+  *h = gh;
+#ifdef U8G2_WITH_FONT_ROTATION
+  switch(decode->dir)
+  {
+    case 1:
+      *x -= gh-1;
+      *w = gh;
+      *h = gw;
+      break;
+    case 2:
+      *x -= gw-1;
+      *y -= gh-1;
+      break;
+    case 3:
+      *y -= gw-1;
+      *w = gh;
+      *h = gw;
+      break;
+  }
+#endif
+}
+
+/*
+  Description:
+    Fill a box with the background color of the font.
+*/
+static void u8g2_font_draw_background(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2->draw_color = u8g2->font_decode.bg_color;
+  u8g2_DrawBox(u8g2, x, y, w, h);
+  u8g2->draw_color = u8g2->font_decode.fg_color;
+}
+#endif /* U8G2_WITH_FONT_SOLID_BOX */
+
+/*
+  Description:
+    Draw the runs of the glyph. u8g2_font_setup_decode() must have been
+    called and the glyph header must have been read.
+    u8g2->font_decode.target_x/y is the upper left corner of the glyph.
+*/
+static void u8g2_font_decode_glyph_runs(u8g2_t *u8g2, const uint8_t *glyph_data)
+{
+  uint8_t a, b;
+  u8g2_font_rle_t rle;
+  int8_t h;
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+
+  h = decode->glyph_height;
+
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+  if ( u8g2->font_bitmap_cache != NULL )
+  {
+    const uint8_t *bitmap;
+    uint8_t bytes_per_column = ((uint8_t)h+7)>>3;
+    bitmap = u8g2_font_get_bitmap(u8g2, glyph_data, bytes_per_column);
+    if ( bitmap != NULL )
+    {
+      u8g2_font_draw_bitmap(u8g2, bitmap, bytes_per_column);
+      /* restore the u8g2 draw color, because this is modified by u8g2_font_draw_bitmap() */
+      u8g2->draw_color = decode->fg_color;
+      return;
+    }
+  }
+#else
+  (void)glyph_data;
+#endif /* U8G2_WITH_FONT_BITMAP_CACHE */
+ 
+  /* reset local x/y position */
+  decode->x = 0;
+  decode->y = 0;
+  
+  /* decode glyph */
+  u8g2_font_rle_start(u8g2, &rle);
+  for(;;)
+  {
+    u8g2_font_rle_get_tuple(&rle, &a, &b);
+    do
+    {
+#ifdef U8G2_WITH_FONT_DIR_DECODE
+      decode->decode_len(u8g2, a, 0);
+      decode->decode_len(u8g2, b, 1);
+#else
+      u8g2_font_decode_len(u8g2, a, 0);
+      u8g2_font_decode_len(u8g2, b, 1);
+#endif
+    } while( u8g2_font_rle_get_repeat(&rle) != 0 );
+
+    if ( decode->y >= h )
+      break;
+  }
+  
+  /* restore the u8g2 draw color, because this is modified by the decode algo */
+  u8g2->draw_color = decode->fg_color;
+}
+
 /* optimized */
 int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
 {
-  uint8_t a, b;
   int8_t x, y;
   int8_t d;
   int8_t h;
@@ -626,6 +1092,14 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
   
   if ( decode->glyph_width > 0 )
   {
+#ifdef U8G2_WITH_DISPLAY_LIST
+    if ( u8g2_is_dlist_record(u8g2) )
+    {
+      /* only store a reference to the glyph, it will be decoded again for each page */
+      u8g2_dlist_add_glyph(u8g2, glyph_data, decode->target_x, decode->target_y);
+      return d;
+    }
+#endif
 #ifdef U8G2_WITH_FONT_ROTATION
     decode->target_x = u8g2_add_vector_x(decode->target_x, x, -(h+y), decode->dir);
     decode->target_y = u8g2_add_vector_y(decode->target_y, x, -(h+y), decode->dir);
@@ -683,83 +1157,237 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
 	return d;
     }
 #endif /* U8G2_WITH_INTERSECTION */
-   
-    /* reset local x/y position */
-    decode->x = 0;
-    decode->y = 0;
-    
-    /* decode glyph */
-    for(;;)
-    {
-      a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
-      b = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_1);
-      do
-      {
-	u8g2_font_decode_len(u8g2, a, 0);
-	u8g2_font_decode_len(u8g2, b, 1);
-      } while( u8g2_font_decode_get_unsigned_bits(decode, 1) != 0 );
 
-      if ( decode->y >= h )
-	break;
+#ifdef U8G2_WITH_FONT_SOLID_BOX
+    if ( decode->is_transparent == 0 && decode->fg_color < 2 )
+    {
+      u8g2_uint_t cx, cy, cw, ch;
+      /* fill the cell once with the background color, then draw the foreground runs only */
+      u8g2_font_get_glyph_cell(decode, &cx, &cy, &cw, &ch);
+      u8g2_font_draw_background(u8g2, cx, cy, cw, ch);
+      decode->is_transparent = 1;
+      u8g2_font_decode_glyph_runs(u8g2, glyph_data);
+      decode->is_transparent = 0;
+      return d;
     }
-    
-    /* restore the u8g2 draw color, because this is modified by the decode algo */
-    u8g2->draw_color = decode->fg_color;
+#endif /* U8G2_WITH_FONT_SOLID_BOX */
+    u8g2_font_decode_glyph_runs(u8g2, glyph_data);
   }
   return d;
 }
 
 
-int8_t u8g2_font_2x_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
+#ifdef U8G2_WITH_FONT_SCALE_BITMAP
+/* scaled nibbles for the scale factors 2, 3 and 4, bit 0 is the upper pixel */
+static const uint16_t u8g2_font_scale_nibble[3][16] = 
 {
-  uint8_t a, b;
-  int8_t x, y;
-  int8_t d;
-  int8_t h;
-  u8g2_font_decode_t *decode = &(u8g2->font_decode);
-    
-  u8g2_font_setup_decode(u8g2, glyph_data);     /* set values in u8g2->font_decode data structure */
-  h = u8g2->font_decode.glyph_height;
-  
-  x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
-  y = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
-  d = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+  { 0x0000, 0x0003, 0x000c, 0x000f, 0x0030, 0x0033, 0x003c, 0x003f, 0x00c0, 0x00c3, 0x00cc, 0x00cf, 0x00f0, 0x00f3, 0x00fc, 0x00ff },
+  { 0x0000, 0x0007, 0x0038, 0x003f, 0x01c0, 0x01c7, 0x01f8, 0x01ff, 0x0e00, 0x0e07, 0x0e38, 0x0e3f, 0x0fc0, 0x0fc7, 0x0ff8, 0x0fff },
+  { 0x0000, 0x000f, 0x00f0, 0x00ff, 0x0f00, 0x0f0f, 0x0ff0, 0x0fff, 0xf000, 0xf00f, 0xf0f0, 0xf0ff, 0xff00, 0xff0f, 0xfff0, 0xffff }
+};
+
+/*
+  Description:
+    Scale one column of a glyph bitmap (see u8g2_font_decode_bitmap()) 
+    vertically by scale (2, 3 or 4).
+  Args:
+    src		column of the glyph bitmap
+    dest	scaled column, at least ((h+3)/4*4*scale+7)/8 bytes
+    h		height of the glyph
+*/
+static void u8g2_font_scale_column(const uint8_t *src, uint8_t *dest, uint8_t h, uint8_t scale)
+{
+  const uint16_t *table = u8g2_font_scale_nibble[scale-2];
+  uint32_t acc = 0;
+  uint8_t acc_bits = 0;
+  uint8_t nibble_cnt = (h+3)>>2;
+  uint8_t i, b;
   
-  if ( decode->glyph_width > 0 )
+  for( i = 0; i < nibble_cnt; i++ )
   {
-    decode->target_x += x;
-    decode->target_y -= 2*h+y;
-
-#ifdef U8G2_WITH_INTERSECTION
+    b = src[i>>1];
+    if ( i & 1 )
+      b >>= 4;
+    acc |= (uint32_t)table[b & 15] << acc_bits;
+    acc_bits += scale*4;
+    while( acc_bits >= 8 )
     {
-      u8g2_uint_t x0, x1, y0, y1;
-      x0 = decode->target_x;
-      y0 = decode->target_y;
-      x1 = x0;
-      y1 = y0;
-      
-      x1 += 2*decode->glyph_width;
-      y1 += 2*h;      
-      
-      if ( u8g2_IsIntersection(u8g2, x0, y0, x1, y1) == 0 ) 
-	return 2*d;
+      *dest++ = (uint8_t)acc;
+      acc >>= 8;
+      acc_bits -= 8;
     }
-#endif /* U8G2_WITH_INTERSECTION */
-   
-    /* reset local x/y position */
-    decode->x = 0;
-    decode->y = 0;
-    
-    /* decode glyph */
-    for(;;)
-    {
-      a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
-      b = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_1);
-      do
+  }
+  if ( acc_bits > 0 )
+    *dest = (uint8_t)acc;
+}
+
+/*
+  Description:
+    Number of bytes written by u8g2_font_scale_column() for a glyph with
+    height h. This might be a little bit more than the scaled column size.
+*/
+static uint16_t u8g2_font_get_scaled_column_write_size(uint8_t h, uint8_t scale)
+{
+  return (((uint16_t)((h+3)>>2))*scale*4+7)>>3;
+}
+
+/*
+  Description:
+    Check whether a scaled column of a glyph with height h fits into the
+    local buffer of u8g2_font_draw_scaled_bitmap().
+  Return:
+    0, if the glyph must be drawn box by box.
+*/
+static uint8_t u8g2_font_is_scaled_column_size_ok(uint8_t h, uint8_t scale)
+{
+  if ( u8g2_font_get_scaled_column_write_size(h, scale) > U8G2_FONT_SCALE_COLUMN_SIZE )
+    return 0;
+  return 1;
+}
+
+/*
+  Description:
+    Draw the glyph bitmap scaled by decode->scale directly into the buffer.
+    Each column is scaled once into a local bitmap and copied 
+    decode->scale-1 times, the bitmap is written with u8g2->ll_bitmap as 
+    soon as it is full.
+    Requires U8G2_R0, u8g2->ll_bitmap and u8g2_font_is_scaled_column_size_ok().
+    u8g2->font_decode.target_x/y is the upper left corner of the glyph.
+*/
+static void u8g2_font_draw_scaled_bitmap(u8g2_t *u8g2, const uint8_t *bitmap, uint8_t bytes_per_column)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  uint8_t scaled_bitmap[U8G2_FONT_SCALE_MAX*U8G2_FONT_SCALE_COLUMN_SIZE];	/* scaled columns with (h*scale+7)/8 bytes each */
+  uint8_t scale = decode->scale;
+  uint8_t h = decode->glyph_height;
+  uint8_t lx, i;
+  uint8_t scaled_bytes_per_column = ((uint16_t)h*scale+7)>>3;
+  uint16_t column_size = (uint16_t)(scale-1)*scaled_bytes_per_column + u8g2_font_get_scaled_column_write_size(h, scale);
+  uint16_t pos;		/* write position in scaled_bitmap */
+  u8g2_uint_t x = decode->target_x;
+  u8g2_uint_t w = 0;	/* number of columns in scaled_bitmap */
+  
+  if ( decode->is_transparent == 0 )
+  {
+    u8g2->draw_color = decode->bg_color;
+    u8g2_DrawBox(u8g2, decode->target_x, decode->target_y, (u8g2_uint_t)decode->glyph_width*scale, (u8g2_uint_t)h*scale);
+    u8g2->draw_color = decode->fg_color;
+  }
+  
+  pos = 0;
+  for( lx = 0; lx < decode->glyph_width; lx++ )
+  {
+    if ( pos + column_size > (uint16_t)sizeof(scaled_bitmap) )
+    {
+      u8g2_draw_bitmap_clip(u8g2, x, decode->target_y, w, (u8g2_uint_t)h*scale, scaled_bitmap, scaled_bytes_per_column);
+      x += w;
+      w = 0;
+      pos = 0;
+    }
+    /* the scaled column might be a little bit larger than scaled_bytes_per_column, this is overwritten by the copies */
+    u8g2_font_scale_column(bitmap, scaled_bitmap + pos, h, scale);
+    for( i = 1; i < scale; i++ )
+    {
+      memcpy(scaled_bitmap + pos + i*scaled_bytes_per_column, scaled_bitmap + pos, scaled_bytes_per_column);
+    }
+    pos += (uint16_t)scale*scaled_bytes_per_column;
+    w += scale;
+    bitmap += bytes_per_column;
+  }
+  u8g2_draw_bitmap_clip(u8g2, x, decode->target_y, w, (u8g2_uint_t)h*scale, scaled_bitmap, scaled_bytes_per_column);
+}
+#endif /* U8G2_WITH_FONT_SCALE_BITMAP */
+
+/*
+  Description:
+    Decode and draw a glyph, scaled by u8g2->font_decode.scale. The font
+    direction is ignored.
+  Return:
+    Width (delta x advance) of the scaled glyph.
+*/
+static u8g2_uint_t u8g2_font_scaled_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
+{
+  uint8_t a, b;
+  u8g2_font_rle_t rle;
+  int8_t x, y;
+  int8_t d;
+  int8_t h;
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  uint8_t scale = decode->scale;
+    
+  u8g2_font_setup_decode(u8g2, glyph_data);     /* set values in u8g2->font_decode data structure */
+  h = u8g2->font_decode.glyph_height;
+  
+  x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
+  y = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
+  d = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+  
+  if ( decode->glyph_width > 0 )
+  {
+    decode->target_x += x;
+    decode->target_y -= scale*h+y;
+
+#ifdef U8G2_WITH_INTERSECTION
+    {
+      u8g2_uint_t x0, x1, y0, y1;
+      x0 = decode->target_x;
+      y0 = decode->target_y;
+      x1 = x0;
+      y1 = y0;
+      
+      x1 += scale*decode->glyph_width;
+      y1 += scale*h;      
+      
+      if ( u8g2_IsIntersection(u8g2, x0, y0, x1, y1) == 0 ) 
+	return (u8g2_uint_t)(d*scale);
+    }
+#endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_FONT_SCALE_BITMAP
+    /* decode the glyph once and write the scaled columns into the buffer, this does not work for solid XOR mode */
+    if ( scale >= 2 && scale <= U8G2_FONT_SCALE_MAX && u8g2->ll_bitmap != NULL && u8g2->cb->draw_l90 == u8g2_draw_l90_r0 
+      && u8g2_font_is_scaled_column_size_ok((uint8_t)h, scale) != 0
+      && (decode->is_transparent != 0 || decode->fg_color < 2) 
+#ifdef U8G2_WITH_DISPLAY_LIST
+      && u8g2_is_dlist_record(u8g2) == 0
+#endif
+      )
+    {
+      const uint8_t *bitmap = NULL;
+      uint8_t buf[U8G2_FONT_SCALE_BITMAP_SIZE];
+      uint8_t bytes_per_column = ((uint8_t)h+7)>>3;
+      if ( u8g2->font_bitmap_cache != NULL )
+	bitmap = u8g2_font_get_bitmap(u8g2, glyph_data, bytes_per_column);
+      if ( bitmap == NULL && (uint16_t)bytes_per_column * (uint8_t)decode->glyph_width <= U8G2_FONT_SCALE_BITMAP_SIZE )
       {
-	u8g2_font_2x_decode_len(u8g2, a, 0);
-	u8g2_font_2x_decode_len(u8g2, b, 1);
-      } while( u8g2_font_decode_get_unsigned_bits(decode, 1) != 0 );
+	memset(buf, 0, (uint16_t)bytes_per_column * (uint8_t)decode->glyph_width);
+	u8g2_font_decode_bitmap(u8g2, buf, bytes_per_column);
+	bitmap = buf;
+      }
+      if ( bitmap != NULL )
+      {
+	u8g2_font_draw_scaled_bitmap(u8g2, bitmap, bytes_per_column);
+	/* restore the u8g2 draw color, because this is modified by u8g2_font_draw_scaled_bitmap() */
+	u8g2->draw_color = decode->fg_color;
+	return (u8g2_uint_t)(d*scale);
+      }
+    }
+#endif /* U8G2_WITH_FONT_SCALE_BITMAP */
+   
+    /* reset local x/y position */
+    decode->x = 0;
+    decode->y = 0;
+    
+    /* decode glyph */
+    u8g2_font_rle_start(u8g2, &rle);
+    for(;;)
+    {
+      u8g2_font_rle_get_tuple(&rle, &a, &b);
+      do
+      {
+	u8g2_font_scaled_decode_len(u8g2, a, 0);
+	u8g2_font_scaled_decode_len(u8g2, b, 1);
+      } while( u8g2_font_rle_get_repeat(&rle) != 0 );
 
       if ( decode->y >= h )
 	break;
@@ -768,9 +1396,132 @@ int8_t u8g2_font_2x_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
     /* restore the u8g2 draw color, because this is modified by the decode algo */
     u8g2->draw_color = decode->fg_color;
   }
-  return d*2;
+  return (u8g2_uint_t)(d*scale);
 }
 
+#ifdef U8G2_WITH_FONT_OFFSET_TABLE
+/*
+  Description:
+    Find the starting point of the glyph data in the glyph offset table.
+    The font must have an offset table (font_info.offset_table_type != 0).
+  Return:
+    Address of the glyph data or NULL, if the encoding is not avialable in the font.
+*/
+static const uint8_t *u8g2_font_get_offset_table_glyph_data(u8g2_t *u8g2, uint16_t encoding)
+{
+  const uint8_t *table = u8g2->font + U8G2_FONT_DATA_STRUCT_SIZE;
+  const uint8_t *entry;
+  uint16_t cnt = u8g2_font_get_word(table, 2);
+  uint16_t lo, hi, mid, e;
+  uint32_t offset;
+  
+  if ( u8g2->font_info.offset_table_type == U8G2_FONT_OFFSET_TABLE_DENSE )
+  {
+    e = encoding - u8g2_font_get_word(table, 4);	/* wraps around for encodings below the first entry */
+    if ( e >= cnt )
+      return NULL;
+    entry = table + 6 + (size_t)e*3;
+  }
+  else
+  {
+    lo = 0;
+    hi = cnt;
+    for(;;)
+    {
+      if ( lo >= hi )
+	return NULL;
+      mid = (lo + hi) >> 1;
+      entry = table + 4 + (size_t)mid*5;
+      e = u8g2_font_get_word(entry, 0);
+      if ( e == encoding )
+	break;
+      if ( e < encoding )
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+    entry += 2;
+  }
+  
+  offset = u8x8_pgm_read( entry );
+  offset <<= 8;
+  offset |= u8x8_pgm_read( entry + 1 );
+  offset <<= 8;
+  offset |= u8x8_pgm_read( entry + 2 );
+  if ( offset == 0x0ffffff )
+    return NULL;
+  
+  entry = table + u8g2->font_info.offset_table_size;
+  entry += offset;
+  if ( encoding <= 255 )
+    return entry+2;	/* skip encoding and glyph size */
+  return entry+3;	/* skip 16 bit encoding and glyph size */
+}
+#endif
+
+#ifdef U8G2_WITH_UNICODE
+/*
+  Description:
+    Find the starting point of the glyph data for a glyph above 255.
+    The unicode lookup table contains one entry for each block of glyphs:
+      word: offset to the start of the block, relative to the previous block
+      word: encoding of the last glyph in the block (0x0ffff for the last entry)
+    The offset of the first entry is the size of the lookup table. 
+*/
+static const uint8_t *u8g2_font_get_unicode_glyph_data(u8g2_t *u8g2, uint16_t encoding)
+{
+  const uint8_t *font = u8g2->font;
+  const uint8_t *unicode_lookup_table;
+  uint16_t e;
+  uint16_t lo, hi, mid;
+  
+#ifdef U8G2_WITH_FONT_OFFSET_TABLE
+  if ( u8g2->font_info.offset_table_type != 0 )
+    return u8g2_font_get_offset_table_glyph_data(u8g2, encoding);
+#endif
+  
+  font += U8G2_FONT_DATA_STRUCT_SIZE;
+  font += u8g2->font_info.offset_table_size;
+  font += u8g2->font_info.start_pos_unicode;
+  unicode_lookup_table = font; 
+
+  /* issue 596: search for the glyph block in the unicode lookup table */
+  lo = 0;
+  hi = (u8g2_font_get_word(unicode_lookup_table, 0) >> 2) - 1;	/* the last entry always matches */
+  while( lo < hi )
+  {
+    mid = (lo + hi) >> 1;
+    if ( u8g2_font_get_word(unicode_lookup_table + ((size_t)mid << 2), 2) < encoding )
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  
+  /* the offsets are relative: add the offsets up to the found entry */
+  for(;;)
+  {
+    font += u8g2_font_get_word(unicode_lookup_table, 0);
+    if ( lo == 0 )
+      break;
+    lo--;
+    unicode_lookup_table+=4;
+  }
+  
+  for(;;)
+  {
+    e = u8x8_pgm_read( font );
+    e <<= 8;
+    e |= u8x8_pgm_read( font + 1 );
+    if ( e == 0 )
+      break;
+    if ( e == encoding )
+      return font+3;	/* skip encoding and glyph size */
+    font += u8x8_pgm_read( font + 2 );
+  }  
+  return NULL;
+}
+#endif
+
 /*
   Description:
     Find the starting point of the glyph data.
@@ -783,10 +1534,26 @@ const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
 {
   const uint8_t *font = u8g2->font;
   font += U8G2_FONT_DATA_STRUCT_SIZE;
+  font += u8g2->font_info.offset_table_size;
 
   
   if ( encoding <= 255 )
   {
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+    if ( u8g2->font_glyph_index != NULL && u8g2->font_glyph_index_font == u8g2->font )
+    {
+      uint16_t pos = u8g2->font_glyph_index[encoding];
+      if ( pos == 0 )
+	return NULL;		/* glyph does not exist */
+      if ( pos != 0x0ffff )
+	return u8g2->font + pos;
+      /* glyph position is not in the index, search the glyph */
+    }
+#endif
+#ifdef U8G2_WITH_FONT_OFFSET_TABLE
+    if ( u8g2->font_info.offset_table_type != 0 )
+      return u8g2_font_get_offset_table_glyph_data(u8g2, encoding);
+#endif
     if ( encoding >= 'a' )
     {
       font += u8g2->font_info.start_pos_lower_a;
@@ -810,62 +1577,52 @@ const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
 #ifdef U8G2_WITH_UNICODE
   else
   {
-    uint16_t e;
-    const uint8_t *unicode_lookup_table;
-    
-// removed, there is now the new index table
-//#ifdef  __unix__
-//    if ( u8g2->last_font_data != NULL && encoding >= u8g2->last_unicode )
-//    {
-//	font = u8g2->last_font_data;
-//    }
-//    else
-//#endif 
-
-    font += u8g2->font_info.start_pos_unicode;
-    unicode_lookup_table = font; 
-  
-    /* issue 596: search for the glyph start in the unicode lookup table */
-    do
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+    u8g2_font_glyph_cache_t *c;
+    if ( u8g2->font_glyph_cache != NULL )
     {
-      font += u8g2_font_get_word(unicode_lookup_table, 0);
-      e = u8g2_font_get_word(unicode_lookup_table, 2);
-      unicode_lookup_table+=4;
-    } while( e < encoding );
-    
-  
-    for(;;)
-    {
-      e = u8x8_pgm_read( font );
-      e <<= 8;
-      e |= u8x8_pgm_read( font + 1 );
-  
-// removed, there is now the new index table  
-//#ifdef  __unix__
-//      if ( encoding < e )
-//        break;
-//#endif 
-
-      if ( e == 0 )
-	break;
-  
-      if ( e == encoding )
-      {
-// removed, there is now the new index table
-//#ifdef  __unix__
-//	u8g2->last_font_data = font;
-//	u8g2->last_unicode = encoding;
-//#endif 
-	return font+3;	/* skip encoding and glyph size */
-      }
-      font += u8x8_pgm_read( font + 2 );
-    }  
+      c = u8g2->font_glyph_cache + (encoding & u8g2->font_glyph_cache_mask);
+      if ( c->font == u8g2->font && c->encoding == encoding )
+	return c->glyph_data;
+      c->glyph_data = u8g2_font_get_unicode_glyph_data(u8g2, encoding);
+      c->font = u8g2->font;
+      c->encoding = encoding;
+      return c->glyph_data;
+    }
+#endif
+    return u8g2_font_get_unicode_glyph_data(u8g2, encoding);
   }
 #endif
   
   return NULL;
 }
 
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+/*
+  Description:
+    Assign a direct mapped cache for the glyph data of unicode glyphs.
+    Only a power of two of the cnt entries is used (cnt is rounded down).
+    A NULL pointer or cnt = 0 will disable the cache.
+    
+    u8g2_font_glyph_cache_t glyph_cache[32];
+    u8g2_SetFontGlyphCache(&u8g2, glyph_cache, 32);
+*/
+void u8g2_SetFontGlyphCache(u8g2_t *u8g2, u8g2_font_glyph_cache_t *buf, uint8_t cnt)
+{
+  uint8_t i;
+  while( (cnt & (cnt-1)) != 0 )
+    cnt &= cnt-1;		/* keep the highest bit */
+  if ( cnt == 0 )
+    buf = NULL;
+  u8g2->font_glyph_cache = buf;
+  u8g2->font_glyph_cache_mask = cnt-1;
+  if ( buf != NULL )
+    for( i = 0; i < cnt; i++ )
+      buf[i].font = NULL;
+}
+#endif
+
+
 static u8g2_uint_t u8g2_font_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
 {
   u8g2_uint_t dx = 0;
@@ -881,15 +1638,35 @@ static u8g2_uint_t u8g2_font_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t
   return dx;
 }
 
-static u8g2_uint_t u8g2_font_2x_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
+#ifdef U8G2_WITH_DISPLAY_LIST
+void u8g2_font_replay_glyph(u8g2_t *u8g2, const uint8_t *font, const uint8_t *glyph_data, u8g2_uint_t x, u8g2_uint_t y)
+{
+  /* only the font info is required for decoding, u8g2_SetFont() is not used here */
+  if ( u8g2->font != font )
+  {
+    u8g2->font = font;
+    if ( font != NULL )
+      u8g2_read_font_info(&(u8g2->font_info), font);
+  }
+  if ( glyph_data != NULL )
+  {
+    u8g2->font_decode.target_x = x;
+    u8g2->font_decode.target_y = y;
+    u8g2_font_decode_glyph(u8g2, glyph_data);
+  }
+}
+#endif
+
+static u8g2_uint_t u8g2_font_scaled_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, uint16_t encoding)
 {
   u8g2_uint_t dx = 0;
   u8g2->font_decode.target_x = x;
   u8g2->font_decode.target_y = y;
+  u8g2->font_decode.scale = scale;
   const uint8_t *glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
   if ( glyph_data != NULL )
   {
-    dx = u8g2_font_2x_decode_glyph(u8g2, glyph_data);
+    dx = u8g2_font_scaled_decode_glyph(u8g2, glyph_data);
   }
   return dx;
 }
@@ -957,18 +1734,194 @@ u8g2_uint_t u8g2_DrawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t
   return u8g2_font_draw_glyph(u8g2, x, y, encoding);
 }
 
+/*
+  Draw a glyph, scaled by 1 (no scaling), 2, 3 or 4. The font direction is ignored.
+*/
+u8g2_uint_t u8g2_DrawGlyphScaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, uint16_t encoding)
+{
+  y += scale*u8g2->font_calc_vref(u8g2);
+  return u8g2_font_scaled_draw_glyph(u8g2, x, y, scale, encoding);
+}
+
 u8g2_uint_t u8g2_DrawGlyphX2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
 {
-  y += 2*u8g2->font_calc_vref(u8g2);
-  return u8g2_font_2x_draw_glyph(u8g2, x, y, encoding);
+  return u8g2_DrawGlyphScaled(u8g2, x, y, 2, encoding);
 }
 
+#ifdef U8G2_WITH_FONT_SOLID_BOX
+/*
+  Description:
+    Draw the background box for the glyphs in the list, followed by the
+    foreground runs of each glyph.
+*/
+static void u8g2_draw_solid_glyph_list(u8g2_t *u8g2, const uint8_t **glyph_list, u8g2_uint_t *x_list, u8g2_uint_t *y_list, uint8_t cnt, 
+  u8g2_uint_t bx, u8g2_uint_t by, u8g2_uint_t bw, u8g2_uint_t bh)
+{
+  uint8_t i;
+  if ( cnt == 0 )
+    return;
+  u8g2_font_draw_background(u8g2, bx, by, bw, bh);
+  u8g2->font_decode.is_transparent = 1;
+  for( i = 0; i < cnt; i++ )
+  {
+    u8g2->font_decode.target_x = x_list[i];
+    u8g2->font_decode.target_y = y_list[i];
+    u8g2_font_decode_glyph(u8g2, glyph_list[i]);
+  }
+  u8g2->font_decode.is_transparent = 0;
+}
+
+/*
+  Description:
+    Solid mode version of u8g2_draw_string(): The cells of adjacent glyphs
+    are merged into one box, which is filled once with the background color.
+    Only the foreground runs of the glyphs are drawn. Up to 
+    U8G2_FONT_SOLID_GLYPH_CNT glyphs are merged. Glyphs which overlap 
+    (negative kerning or offsets) start a new box, so the result is
+    identical to u8g2_draw_string().
+*/
+static u8g2_uint_t u8g2_draw_solid_string(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  const uint8_t *glyph_list[U8G2_FONT_SOLID_GLYPH_CNT];
+  u8g2_uint_t x_list[U8G2_FONT_SOLID_GLYPH_CNT];
+  u8g2_uint_t y_list[U8G2_FONT_SOLID_GLYPH_CNT];
+  uint8_t cnt = 0;
+  u8g2_uint_t bx = 0, by = 0, bw = 0, bh = 0;	/* box for the glyphs in the list */
+  u8g2_uint_t cx, cy, cw, ch;				/* cell of the current glyph */
+  const uint8_t *glyph_data;
+  uint16_t e;
+  int8_t gx, gy, h;
+  u8g2_uint_t delta, sum;
+#ifdef U8G2_WITH_FONT_ROTATION
+  uint8_t dir = decode->dir;
+
+  switch(dir)
+  {
+    case 0:
+      y += u8g2->font_calc_vref(u8g2);
+      break;
+    case 1:
+      x -= u8g2->font_calc_vref(u8g2);
+      break;
+    case 2:
+      y -= u8g2->font_calc_vref(u8g2);
+      break;
+    case 3:
+      x += u8g2->font_calc_vref(u8g2);
+      break;
+  }
+#else
+  y += u8g2->font_calc_vref(u8g2);
+#endif
+
+  u8x8_utf8_init(u8g2_GetU8x8(u8g2));
+  sum = 0;
+  for(;;)
+  {
+    e = u8g2->u8x8.next_cb(u8g2_GetU8x8(u8g2), (uint8_t)*str);
+    if ( e == 0x0ffff )
+      break;
+    str++;
+    if ( e == 0x0fffe )
+      continue;
+    glyph_data = u8g2_font_get_glyph_data(u8g2, e);
+    if ( glyph_data == NULL )
+      continue;
+    
+    /* read the glyph header, see u8g2_font_decode_glyph() */
+    u8g2_font_setup_decode(u8g2, glyph_data);
+    h = decode->glyph_height;
+    gx = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
+    gy = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
+    delta = (int8_t)u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+    
+    if ( decode->glyph_width > 0 )
+    {
+#ifdef U8G2_WITH_FONT_ROTATION
+      decode->target_x = u8g2_add_vector_x(x, gx, -(h+gy), dir);
+      decode->target_y = u8g2_add_vector_y(y, gx, -(h+gy), dir);
+#else
+      decode->target_x = x + gx;
+      decode->target_y = y - (h+gy);
+#endif
+      u8g2_font_get_glyph_cell(decode, &cx, &cy, &cw, &ch);
+      
+      if ( cnt > 0 && cnt < U8G2_FONT_SOLID_GLYPH_CNT && cy == by && ch == bh && cx == bx+bw )
+      {
+	bw += cw;		/* left to right */
+      }
+      else if ( cnt > 0 && cnt < U8G2_FONT_SOLID_GLYPH_CNT && cy == by && ch == bh && cx+cw == bx )
+      {
+	bx = cx;		/* right to left */
+	bw += cw;
+      }
+      else if ( cnt > 0 && cnt < U8G2_FONT_SOLID_GLYPH_CNT && cx == bx && cw == bw && cy == by+bh )
+      {
+	bh += ch;		/* top to bottom */
+      }
+      else if ( cnt > 0 && cnt < U8G2_FONT_SOLID_GLYPH_CNT && cx == bx && cw == bw && cy+ch == by )
+      {
+	by = cy;		/* bottom to top */
+	bh += ch;
+      }
+      else
+      {
+	u8g2_draw_solid_glyph_list(u8g2, glyph_list, x_list, y_list, cnt, bx, by, bw, bh);
+	cnt = 0;
+	bx = cx;
+	by = cy;
+	bw = cw;
+	bh = ch;
+      }
+      glyph_list[cnt] = glyph_data;
+      x_list[cnt] = x;
+      y_list[cnt] = y;
+      cnt++;
+    }
+    
+#ifdef U8G2_WITH_FONT_ROTATION
+    switch(dir)
+    {
+      case 0:
+	x += delta;
+	break;
+      case 1:
+	y += delta;
+	break;
+      case 2:
+	x -= delta;
+	break;
+      case 3:
+	y -= delta;
+	break;
+    }
+#else
+    x += delta;
+#endif
+    sum += delta;    
+  }
+  u8g2_draw_solid_glyph_list(u8g2, glyph_list, x_list, y_list, cnt, bx, by, bw, bh);
+  return sum;
+}
+#endif /* U8G2_WITH_FONT_SOLID_BOX */
+
 static u8g2_uint_t u8g2_draw_string(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str) U8G2_NOINLINE;
 static u8g2_uint_t u8g2_draw_string(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
 {
   uint16_t e;
   u8g2_uint_t delta, sum;
   u8x8_utf8_init(u8g2_GetU8x8(u8g2));
+
+#ifdef U8G2_WITH_FONT_SOLID_BOX
+  /* solid mode: merge the background of the glyphs, this does not work for XOR */
+  if ( u8g2->font_decode.is_transparent == 0 && u8g2->draw_color < 2 
+#ifdef U8G2_WITH_DISPLAY_LIST
+    && u8g2_is_dlist_record(u8g2) == 0
+#endif
+  )
+    return u8g2_draw_solid_string(u8g2, x, y, str);
+#endif
   sum = 0;
   for(;;)
   {
@@ -1013,8 +1966,8 @@ static u8g2_uint_t u8g2_draw_string(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   return sum;
 }
 
-static u8g2_uint_t u8g2_draw_string_2x(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str) U8G2_NOINLINE;
-static u8g2_uint_t u8g2_draw_string_2x(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
+static u8g2_uint_t u8g2_draw_string_scaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, const char *str) U8G2_NOINLINE;
+static u8g2_uint_t u8g2_draw_string_scaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, const char *str)
 {
   uint16_t e;
   u8g2_uint_t delta, sum;
@@ -1028,7 +1981,7 @@ static u8g2_uint_t u8g2_draw_string_2x(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t
     str++;
     if ( e != 0x0fffe )
     {
-      delta = u8g2_DrawGlyphX2(u8g2, x, y, e);
+      delta = u8g2_DrawGlyphScaled(u8g2, x, y, scale, e);
       x += delta;
       sum += delta;    
     }
@@ -1045,7 +1998,13 @@ u8g2_uint_t u8g2_DrawStr(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char
 u8g2_uint_t u8g2_DrawStrX2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
 {
   u8g2->u8x8.next_cb = u8x8_ascii_next;
-  return u8g2_draw_string_2x(u8g2, x, y, str);
+  return u8g2_draw_string_scaled(u8g2, x, y, 2, str);
+}
+
+u8g2_uint_t u8g2_DrawStrScaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, const char *str)
+{
+  u8g2->u8x8.next_cb = u8x8_ascii_next;
+  return u8g2_draw_string_scaled(u8g2, x, y, scale, str);
 }
 
 /*
@@ -1067,7 +2026,13 @@ u8g2_uint_t u8g2_DrawUTF8(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char
 u8g2_uint_t u8g2_DrawUTF8X2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const char *str)
 {
   u8g2->u8x8.next_cb = u8x8_utf8_next;
-  return u8g2_draw_string_2x(u8g2, x, y, str);
+  return u8g2_draw_string_scaled(u8g2, x, y, 2, str);
+}
+
+u8g2_uint_t u8g2_DrawUTF8Scaled(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t scale, const char *str)
+{
+  u8g2->u8x8.next_cb = u8x8_utf8_next;
+  return u8g2_draw_string_scaled(u8g2, x, y, scale, str);
 }
 
 
@@ -1276,6 +2241,66 @@ void u8g2_SetFontPosCenter(u8g2_t *u8g2)
 
 /*===============================================*/
 
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+/*
+  Store the position of the glyph data (relative to the start of the font) 
+  for each glyph 0..255 of the current font:
+    0		glyph does not exist
+    0x0ffff	glyph is too far away from the start of the font, search the glyph
+*/
+static void u8g2_font_build_glyph_index(u8g2_t *u8g2)
+{
+  const uint8_t *font = u8g2->font;
+  uint16_t *index = u8g2->font_glyph_index;
+  size_t pos;
+  uint16_t i;
+  uint8_t e;
+  
+  u8g2->font_glyph_index_font = font;
+  memset(index, 0, U8G2_FONT_GLYPH_INDEX_CNT*sizeof(uint16_t));
+  if ( font == NULL )
+    return;
+  
+  font += U8G2_FONT_DATA_STRUCT_SIZE;
+  font += u8g2->font_info.offset_table_size;
+  for(;;)
+  {
+    if ( u8x8_pgm_read( font + 1 ) == 0 )
+      break;
+    pos = (font + 2) - u8g2->font;	/* skip encoding and glyph size */
+    if ( pos >= 0x0ffff )
+    {
+      /* all remaining glyphs are searched by u8g2_font_get_glyph_data() */
+      for( i = 0; i < U8G2_FONT_GLYPH_INDEX_CNT; i++ )
+	if ( index[i] == 0 )
+	  index[i] = 0x0ffff;
+      break;
+    }
+    e = u8x8_pgm_read( font );
+    if ( index[e] == 0 )
+      index[e] = pos;
+    font += u8x8_pgm_read( font + 1 );
+  }
+}
+
+/*
+  Description:
+    Assign a memory area with U8G2_FONT_GLYPH_INDEX_CNT entries for the glyph index.
+    The index is built for the current font and again for each new font by 
+    u8g2_SetFont(). A NULL pointer will disable the glyph index.
+    
+    uint16_t glyph_index[U8G2_FONT_GLYPH_INDEX_CNT];
+    u8g2_SetFontGlyphIndex(&u8g2, glyph_index);
+*/
+void u8g2_SetFontGlyphIndex(u8g2_t *u8g2, uint16_t *buf)
+{
+  u8g2->font_glyph_index = buf;
+  u8g2->font_glyph_index_font = NULL;
+  if ( buf != NULL )
+    u8g2_font_build_glyph_index(u8g2);
+}
+#endif /* U8G2_WITH_FONT_GLYPH_INDEX */
+
 void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
 {
   if ( u8g2->font != font )
@@ -1289,6 +2314,10 @@ void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
     u8g2_UpdateRefHeight(u8g2);
     /* u8g2_SetFontPosBaseline(u8g2); */ /* removed with issue 195 */
   }
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+  if ( u8g2->font_glyph_index != NULL && u8g2->font_glyph_index_font != font )
+    u8g2_font_build_glyph_index(u8g2);
+#endif
 }
 
 /*===============================================*/
@@ -1321,8 +2350,7 @@ uint8_t u8g2_IsAllValidUTF8(u8g2_t *u8g2, const char *str)
 
 
 /* string calculation is stilll not 100% perfect as it addes the initial string offset to the overall size */
-static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str) U8G2_NOINLINE;
-static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
+static u8g2_uint_t u8g2_calculate_string_width(u8g2_t *u8g2, const char *str)
 {
   uint16_t e;
   u8g2_uint_t  w, dx;
@@ -1377,6 +2405,74 @@ static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
   return w;  
 }
 
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+/*
+  Description:
+    Assign a direct mapped cache for the string width calculation.
+    cnt is rounded down to a power of two. A NULL pointer or cnt = 0 will 
+    disable the cache. The hit and miss counters are reset.
+    
+    u8g2_str_width_cache_t str_width_cache[16];
+    u8g2_SetStrWidthCache(&u8g2, str_width_cache, 16);
+*/
+void u8g2_SetStrWidthCache(u8g2_t *u8g2, u8g2_str_width_cache_t *buf, uint8_t cnt)
+{
+  uint8_t i;
+  while( (cnt & (cnt-1)) != 0 )
+    cnt &= cnt-1;		/* keep the highest bit */
+  if ( cnt == 0 )
+    buf = NULL;
+  u8g2->str_width_cache = buf;
+  u8g2->str_width_cache_mask = cnt-1;
+  u8g2->str_width_cache_hit_cnt = 0;
+  u8g2->str_width_cache_miss_cnt = 0;
+  if ( buf != NULL )
+    for( i = 0; i < cnt; i++ )
+      buf[i].font = NULL;
+}
+#endif
+
+static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str) U8G2_NOINLINE;
+static u8g2_uint_t u8g2_string_width(u8g2_t *u8g2, const char *str)
+{
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+  u8g2_str_width_cache_t *c;
+  const char *s;
+  uint32_t hash;
+  uint8_t len;
+  uint8_t is_utf8;
+  
+  if ( u8g2->str_width_cache != NULL )
+  {
+    /* djb2 hash of the string selects the entry, the entry is compared with the string */
+    hash = 5381;
+    for( s = str; *s != '\0'; s++ )
+    {
+      if ( s - str >= U8G2_STR_WIDTH_CACHE_LEN )
+	return u8g2_calculate_string_width(u8g2, str);	/* too long for the cache */
+      hash = (hash << 5) + hash + (uint8_t)*s;
+    }
+    len = s - str;
+    is_utf8 = u8g2->u8x8.next_cb == u8x8_utf8_next ? 1 : 0;
+    
+    c = u8g2->str_width_cache + ((hash ^ (hash >> 8)) & u8g2->str_width_cache_mask);
+    if ( c->font == u8g2->font && c->len == len && c->is_utf8 == is_utf8 && memcmp(c->str, str, len) == 0 )
+    {
+      u8g2->str_width_cache_hit_cnt++;
+      return c->width;
+    }
+    u8g2->str_width_cache_miss_cnt++;
+    c->width = u8g2_calculate_string_width(u8g2, str);
+    c->font = u8g2->font;
+    c->len = len;
+    c->is_utf8 = is_utf8;
+    memcpy(c->str, str, len);
+    return c->width;
+  }
+#endif
+  return u8g2_calculate_string_width(u8g2, str);
+}
+
 int8_t u8g2_GetXOffsetGlyph(u8g2_t *u8g2, uint16_t encoding)
 {
   u8g2_GetGlyphWidth(u8g2, encoding);		/* delta x value of the glyph, side effect: updates u8g2->glyph_x_offset */
@@ -137,8 +137,107 @@ void u8g2_draw_hv_line_2dir(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uin
   /* transform to pixel buffer coordinates */
   y -= u8g2->pixel_curr_row;
   
-  u8g2->ll_hvline(u8g2, x, y, len, dir);
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_buf != NULL )
+  {
+    if ( dir == 0 )
+      u8g2_MarkDirtyArea(u8g2, x, y, len, 1);
+    else
+      u8g2_MarkDirtyArea(u8g2, x, y, 1, len);
+  }
+#endif
+  
+  u8g2_get_ll_hvline(u8g2)(u8g2, x, y, len, dir);
+}
+
+#ifdef U8G2_WITH_LL_BOX
+/*
+  x,y		Upper left position of the box within the pixel buffer 
+  w,h		width and height of the box, both must not be 0
+  Box counterpart of u8g2_draw_hv_line_2dir(), called by the draw_b90 procedures
+  after rotation.
+*/
+void u8g2_draw_box_2dir(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  /* transform to pixel buffer coordinates */
+  y -= u8g2->pixel_curr_row;
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_buf != NULL )
+    u8g2_MarkDirtyArea(u8g2, x, y, w, h);
+#endif
+  
+  if ( u8g2->ll_box != NULL )
+  {
+    u8g2->ll_box(u8g2, x, y, w, h);
+  }
+  else
+  {
+    u8g2_draw_ll_hvline_cb ll_hvline = u8g2_get_ll_hvline(u8g2);
+    do
+    {
+      ll_hvline(u8g2, x, y, w, 0);
+      y++;
+      h--;
+    } while( h != 0 );
+  }
+}
+
+/*
+  Clip the box once against the user window and draw it with the
+  draw_b90 procedure of the current rotation. Called by u8g2_DrawBox(), 
+  requires u8g2->cb->draw_b90 != NULL.
+*/
+void u8g2_draw_box_clip(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+  if ( w == 0 || h == 0 )
+    return;
+  if ( u8g2_clip_intersection2(&x, &w, u8g2->user_x0, u8g2->user_x1) == 0 )
+    return;
+  if ( u8g2_clip_intersection2(&y, &h, u8g2->user_y0, u8g2->user_y1) == 0 )
+    return;
+  u8g2->cb->draw_b90(u8g2, x, y, w, h);
+}
+#endif /* U8G2_WITH_LL_BOX */
+
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+/*
+  x,y,w,h		position and size of the bitmap
+  bitmap		u8g2_font_bitmap_t bitmap
+  The bitmap is clipped against the user window and drawn with u8g2->ll_bitmap.
+  This is only valid for U8G2_R0.
+*/
+void u8g2_draw_bitmap_clip(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, uint8_t bytes_per_column)
+{
+  u8g2_uint_t cx, cy;
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+  cx = x;
+  cy = y;
+  if ( u8g2_clip_intersection2(&cx, &w, u8g2->user_x0, u8g2->user_x1) == 0 )
+    return;
+  if ( u8g2_clip_intersection2(&cy, &h, u8g2->user_y0, u8g2->user_y1) == 0 )
+    return;
+  bitmap += (size_t)(u8g2_uint_t)(cx - x) * bytes_per_column;
+  y = cy - y;		/* first visible row of the bitmap */
+  
+  /* transform to pixel buffer coordinates */
+  cy -= u8g2->pixel_curr_row;
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2->dirty_tile_buf != NULL )
+    u8g2_MarkDirtyArea(u8g2, cx, cy, w, h);
+#endif
+  
+  u8g2->ll_bitmap(u8g2, cx, cy, w, h, bitmap, y, bytes_per_column);
 }
+#endif /* U8G2_WITH_FONT_BITMAP_CACHE */
 
 
 /*
@@ -195,6 +294,13 @@ void u8g2_DrawHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len
 	  return;
       }
       
+#ifdef U8G2_WITH_DISPLAY_LIST
+      if ( u8g2_is_dlist_record(u8g2) )
+      {
+	u8g2_dlist_add_hvline(u8g2, x, y, len, dir);
+	return;
+      }
+#endif
       
       u8g2->cb->draw_l90(u8g2, x, y, len, dir);
     }
@@ -245,11 +351,21 @@ void u8g2_DrawPixel(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y)
 
   7 Jan 2017: Allow color value 2 for XOR operation.
   
+  Gray level colors (U8G2_DRAW_COLOR_GRAY) are kept for gray buffers and
+  are reduced to 0 or 1 for monochrome buffers.
+  
 */
 void u8g2_SetDrawColor(u8g2_t *u8g2, uint8_t color)
 {
-  u8g2->draw_color = color;	/* u8g2_SetDrawColor: just assign the argument */ 
-  if ( color >= 3 )
-    u8g2->draw_color = 1;	/* u8g2_SetDrawColor: make color as one if arg is invalid */
+  if ( u8g2_is_gray_draw_color(color) )
+  {
+#ifdef U8G2_WITH_GRAY_BUFFER
+    if ( u8g2->bits_per_pixel == 1 )
+#endif
+      color = (color & 8) ? 1 : 0;
+  }
+  else if ( color >= 3 )
+    color = 1;			/* u8g2_SetDrawColor: make color as one if arg is invalid */
+  u8g2->draw_color = color;	/* u8g2_SetDrawColor: assign the color */
 }
 
@@ -43,52 +43,164 @@ uint8_t u8g2_GetNullKerning(u8g2_t *u8g2, uint16_t e1, uint16_t e2)
 }
 */
 
+#ifdef U8G2_WITH_KERNING_CACHE
+/*
+  Description:
+    Assign a direct mapped cache for the kerning values. Only a power 
+    of two of the cnt entries is used. A NULL pointer or cnt = 0 will disable 
+    the cache.
+    
+    u8g2_kerning_cache_t kerning_cache[16];
+    u8g2_SetKerningCache(&u8g2, kerning_cache, 16);
+*/
+void u8g2_SetKerningCache(u8g2_t *u8g2, u8g2_kerning_cache_t *buf, uint8_t cnt)
+{
+  uint8_t i;
+  while( (cnt & (cnt-1)) != 0 )
+    cnt &= cnt-1;		/* keep the highest bit */
+  if ( cnt == 0 )
+    buf = NULL;
+  u8g2->kerning_cache = buf;
+  u8g2->kerning_cache_mask = cnt-1;
+  if ( buf != NULL )
+    for( i = 0; i < cnt; i++ )
+      buf[i].kerning = NULL;
+}
+
+static u8g2_kerning_cache_t *u8g2_get_kerning_cache_entry(u8g2_t *u8g2, uint16_t e1, uint16_t e2)
+{
+  return u8g2->kerning_cache + ((e1 ^ (e2 << 2) ^ (e2 >> 3)) & u8g2->kerning_cache_mask);
+}
+#endif
+
+/*
+  Description:
+    Search for e in the table between index lo (inclusive) and hi (exclusive).
+    A binary search is used if the table is sorted, otherwise a linear search.
+  Return:
+    Index of e or hi, if e is not part of the table
+*/
+static uint16_t u8g2_kerning_search(const uint16_t *table, uint16_t lo, uint16_t hi, uint16_t e, uint8_t is_sorted)
+{
+  uint16_t end = hi;
+  uint16_t mid;
+  if ( is_sorted == 0 )
+  {
+    while( lo < hi && table[lo] != e )
+      lo++;
+    return lo;
+  }
+  while( lo < hi )
+  {
+    mid = lo + ((hi - lo) >> 1);
+    if ( table[mid] < e )
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if ( lo < end && table[lo] == e )
+    return lo;
+  return end;
+}
+
 /* this function is used as "u8g2_get_kerning_cb" */
+/*
+  If is_sorted is set, the first_encoding_table and each part of the 
+  second_encoding_table must be sorted by encoding. This is done by bdfconv.
+  Tables without is_sorted (older bdfconv versions or written by hand) are 
+  searched linearly.
+*/
 uint8_t u8g2_GetKerning(U8X8_UNUSED u8g2_t *u8g2, u8g2_kerning_t *kerning, uint16_t e1, uint16_t e2)
 {
   uint16_t i1, i2, cnt, end;
+  uint8_t value;
+#ifdef U8G2_WITH_KERNING_CACHE
+  u8g2_kerning_cache_t *c = NULL;
+#endif
   if ( kerning == NULL )
     return 0;
   
+#ifdef U8G2_WITH_KERNING_CACHE
+  if ( u8g2->kerning_cache != NULL )
+  {
+    c = u8g2_get_kerning_cache_entry(u8g2, e1, e2);
+    if ( c->kerning == kerning && c->e1 == e1 && c->e2 == e2 )
+      return c->value;
+  }
+#endif
+  
+  value = 0;
+  
   /* search for the encoding in the first table */
   cnt = kerning->first_table_cnt;
   cnt--;	/* ignore the last element of the table, which is 0x0ffff */
-  for( i1 = 0; i1 < cnt; i1++ )
+  i1 = u8g2_kerning_search(kerning->first_encoding_table, 0, cnt, e1, kerning->is_sorted);
+  if ( i1 < cnt )	/* otherwise e1 is not part of the kerning table */
   {
-    if ( kerning->first_encoding_table[i1] == e1 )
-      break;
+    /* get the upper index for i2 */
+    end = kerning->index_to_second_table[i1+1];
+    i2 = u8g2_kerning_search(kerning->second_encoding_table, kerning->index_to_second_table[i1], end, e2, kerning->is_sorted);
+    if ( i2 < end )	/* otherwise e2 is not part of any pair with e1 */
+      value = kerning->kerning_values[i2];
   }
-  if ( i1 >= cnt )
-    return 0;	/* e1 not part of the kerning table, return 0 */
-
-  /* get the upper index for i2 */
-  end = kerning->index_to_second_table[i1+1];
-  for( i2 = kerning->index_to_second_table[i1]; i2 < end; i2++ )
+  
+#ifdef U8G2_WITH_KERNING_CACHE
+  if ( c != NULL )
   {
-    if ( kerning->second_encoding_table[i2] == e2 )
-      break;
+    c->kerning = kerning;
+    c->e1 = e1;
+    c->e2 = e2;
+    c->value = value;
   }
-  
-  if ( i2 >= end )
-    return 0;	/* e2 not part of any pair with e1, return 0 */
-  
-  return kerning->kerning_values[i2];
+#endif
+  return value;
 }
 
+/*
+  The kerning table is usually written by hand, so it is not sorted and 
+  has to be searched linearly. Use the kerning cache to avoid this.
+*/
 uint8_t u8g2_GetKerningByTable(U8X8_UNUSED u8g2_t *u8g2, const uint16_t *kt, uint16_t e1, uint16_t e2)
 {
   uint16_t i;
+  uint8_t value;
+#ifdef U8G2_WITH_KERNING_CACHE
+  u8g2_kerning_cache_t *c = NULL;
+#endif
   i = 0;
   if ( kt == NULL )
     return 0;
+  
+#ifdef U8G2_WITH_KERNING_CACHE
+  if ( u8g2->kerning_cache != NULL )
+  {
+    c = u8g2_get_kerning_cache_entry(u8g2, e1, e2);
+    if ( c->kerning == kt && c->e1 == e1 && c->e2 == e2 )
+      return c->value;
+  }
+#endif
+  
+  value = 0;
   for(;;)
   {
     if ( kt[i] == 0x0ffff )
       break;
     if ( kt[i] == e1 && kt[i+1] == e2 )
-      return kt[i+2];
+    {
+      value = kt[i+2];
+      break;
+    }
     i+=3;
   }
-  return 0;
+  
+#ifdef U8G2_WITH_KERNING_CACHE
+  if ( c != NULL )
+  {
+    c->kerning = kt;
+    c->e1 = e1;
+    c->e2 = e2;
+    c->value = value;
+  }
+#endif
+  return value;
 }
-
@@ -50,6 +50,7 @@
 
 #include "u8g2.h"
 #include <assert.h>
+#include <string.h>
 
 /*=================================================*/
 /*
@@ -61,20 +62,38 @@
 
 #ifdef U8G2_WITH_HVLINE_SPEED_OPTIMIZATION
 
+/*
+  apply "mask" to the byte at "ptr"
+    color 0:	clear pixel
+    color 1:	set pixel
+    color 2:	xor pixel
+  For the draw color specific procedures, "color" is a constant, so that
+  the compiler will remove the color check from the inner loops.
+*/
+static U8G2_ALWAYS_INLINE void u8g2_ll_apply_mask(uint8_t *ptr, uint8_t mask, uint8_t color)
+{
+  if ( color == 1 )
+    *ptr |= mask;
+  else if ( color == 0 )
+    *ptr &= ~mask;
+  else
+    *ptr ^= mask;
+}
+
 /*
   x,y		Upper left position of the line within the local buffer (not the display!)
   len		length of the line in pixel, len must not be 0
   dir		0: horizontal line (left to right)
 		1: vertical line (top to bottom)
+  color	draw color (see u8g2_ll_apply_mask)
   asumption: 
     all clipping done
 */
-void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+static U8G2_ALWAYS_INLINE void u8g2_ll_hvline_vertical_top_lsb_color(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir, uint8_t color)
 {
-  uint16_t offset;
+  size_t offset;
   uint8_t *ptr;
   uint8_t bit_pos, mask;
-  uint8_t or_mask, xor_mask;
 #ifdef __unix
   uint8_t *max_ptr = u8g2->tile_buf_ptr + u8g2_GetU8x8(u8g2)->display_info->tile_width*u8g2->tile_buf_height*8;
 #endif
@@ -90,15 +109,7 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   mask = 1;
   mask <<= bit_pos;
 
-  or_mask = 0;
-  xor_mask = 0;
-  if ( u8g2->draw_color <= 1 )
-    or_mask  = mask;
-  if ( u8g2->draw_color != 1 )
-    xor_mask = mask;
-
-
-  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
   offset &= ~7;
   offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
   ptr = u8g2->tile_buf_ptr;
@@ -112,45 +123,136 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 #ifdef __unix
 	assert(ptr < max_ptr);
 #endif
-	*ptr |= or_mask;
-	*ptr ^= xor_mask;
+	u8g2_ll_apply_mask(ptr, mask, color);
 	ptr++;
 	len--;
       } while( len != 0 );
   }
   else
-  {    
-    do
+  {
+    /*
+      page mode:
+	head:	partial byte from bit_pos to the lower edge of the page
+	body:	full bytes for each page, which is completely covered by the line
+	tail:	partial byte with the remaining pixel of the line
+    */
+    mask = 0x0ff;
+    mask <<= bit_pos;		/* pixel from bit_pos to the lower edge of the page */
+    bit_pos = 8-bit_pos;	/* number of pixel in the head byte */
+    for(;;)
     {
+      if ( len < bit_pos )
+      {
+	/* the line ends within this byte, remove the pixel below the line */
+	mask &= 0x0ff >> (bit_pos-len);
+	bit_pos = len;
+      }
+      
 #ifdef __unix
       assert(ptr < max_ptr);
 #endif
-      *ptr |= or_mask;
-      *ptr ^= xor_mask;
+      u8g2_ll_apply_mask(ptr, mask, color);
+      
+      len -= bit_pos;
+      if ( len == 0 )
+	break;
+      ptr+=u8g2->pixel_buf_width;	/* 6 Jan 17: Changed u8g2->width to u8g2->pixel_buf_width, issue #148 */
       
-      bit_pos++;
-      bit_pos &= 7;
+      /* next page: full byte or the remaining pixel of the line */
+      mask = 0x0ff;
+      bit_pos = 8;
+    }
+  }
+}
 
-      len--;
+void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_vertical_top_lsb_color(u8g2, x, y, len, dir, u8g2->draw_color);
+}
 
-      if ( bit_pos == 0 )
-      {
-	ptr+=u8g2->pixel_buf_width;	/* 6 Jan 17: Changed u8g2->width to u8g2->pixel_buf_width, issue #148 */
-		
-	if ( u8g2->draw_color <= 1 )
-	  or_mask  = 1;
-	if ( u8g2->draw_color != 1 )
-	  xor_mask = 1;
-      }
-      else
-      {
-	or_mask <<= 1;
-	xor_mask <<= 1;
-      }
-    } while( len != 0 );
+#ifdef U8G2_WITH_HVLINE_COLOR_SPECIALIZATION
+void u8g2_ll_hvline_vertical_top_lsb_and_not(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_vertical_top_lsb_color(u8g2, x, y, len, dir, 0);
+}
+
+void u8g2_ll_hvline_vertical_top_lsb_or(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_vertical_top_lsb_color(u8g2, x, y, len, dir, 1);
+}
+
+void u8g2_ll_hvline_vertical_top_lsb_xor(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_vertical_top_lsb_color(u8g2, x, y, len, dir, 2);
+}
+#endif /* U8G2_WITH_HVLINE_COLOR_SPECIALIZATION */
+
+#ifdef U8G2_WITH_LL_BOX
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box, both must not be 0
+  color	draw color (see u8g2_ll_apply_mask)
+  
+  The box is filled page by page: The mask for the bytes of one page is
+  calculated once and applied to w bytes. Completely covered pages are
+  written with memset (draw color 0 and 1).
+*/
+static U8G2_ALWAYS_INLINE void u8g2_ll_box_vertical_top_lsb_color(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, uint8_t color)
+{
+  size_t offset;
+  uint8_t *ptr;
+  uint8_t bit_pos, mask;
+  u8g2_uint_t i;
+  
+  bit_pos = y;
+  bit_pos &= 7;
+  
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
+  offset &= ~7;
+  offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+  ptr += x;
+  
+  mask = 0x0ff;
+  mask <<= bit_pos;		/* pixel from bit_pos to the lower edge of the page */
+  bit_pos = 8-bit_pos;	/* number of pixel rows in the first page */
+  for(;;)
+  {
+    if ( h < bit_pos )
+    {
+      /* the box ends within this page, remove the pixel below the box */
+      mask &= 0x0ff >> (bit_pos-h);
+      bit_pos = h;
+    }
+    
+    if ( mask == 0x0ff && color != 2 )
+      memset(ptr, color == 0 ? 0 : 0x0ff, w);
+    else
+      for( i = 0; i < w; i++ )
+	u8g2_ll_apply_mask(ptr+i, mask, color);
+    
+    h -= bit_pos;
+    if ( h == 0 )
+      break;
+    ptr+=u8g2->pixel_buf_width;
+    mask = 0x0ff;
+    bit_pos = 8;
   }
 }
 
+void u8g2_ll_box_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  /* expand the inner loop for each draw color */
+  if ( u8g2->draw_color == 0 )
+    u8g2_ll_box_vertical_top_lsb_color(u8g2, x, y, w, h, 0);
+  else if ( u8g2->draw_color == 1 )
+    u8g2_ll_box_vertical_top_lsb_color(u8g2, x, y, w, h, 1);
+  else
+    u8g2_ll_box_vertical_top_lsb_color(u8g2, x, y, w, h, 2);
+}
+#endif /* U8G2_WITH_LL_BOX */
+
 
 
 #else /* U8G2_WITH_HVLINE_SPEED_OPTIMIZATION */
@@ -160,7 +262,7 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 */
 static void u8g2_draw_pixel_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y)
 {
-  uint16_t offset;
+  size_t offset;
   uint8_t *ptr;
   uint8_t bit_pos, mask;
   
@@ -175,7 +277,7 @@ static void u8g2_draw_pixel_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_u
   mask = 1;
   mask <<= bit_pos;
 
-  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
   offset &= ~7;
   offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
   ptr = u8g2->tile_buf_ptr;
@@ -236,17 +338,19 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   len		length of the line in pixel, len must not be 0
   dir		0: horizontal line (left to right)
 		1: vertical line (top to bottom)
+  color	draw color (see u8g2_ll_apply_mask)
   asumption: 
     all clipping done
 */
 
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
-void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+static U8G2_ALWAYS_INLINE void u8g2_ll_hvline_horizontal_right_lsb_color(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir, uint8_t color)
 {
-  uint16_t offset;
+  size_t offset;
   uint8_t *ptr;
   uint8_t bit_pos;
   uint8_t mask;
+  uint16_t byte_cnt;
   uint8_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
 
   bit_pos = x;		/* overflow truncate is ok here... */
@@ -254,7 +358,7 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
   mask = 128;
   mask >>= bit_pos;
 
-  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
   offset *= tile_width;
   offset += x>>3;
   ptr = u8g2->tile_buf_ptr;
@@ -262,35 +366,64 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
   
   if ( dir == 0 )
   {
-      
-    do
+    /* 
+      span mode: 
+	head:	partial byte from bit_pos to the right edge of the byte
+	body:	full bytes, written without any mask
+	tail:	partial byte with the remaining pixel of the line
+    */
+    if ( bit_pos != 0 || len < 8 )
     {
-
-      if ( u8g2->draw_color <= 1 )
-	*ptr |= mask;
-      if ( u8g2->draw_color != 1 )
-	*ptr ^= mask;
-      
-      mask >>= 1;
-      if ( mask == 0 )
+      mask <<= 1;
+      mask--;			/* pixel from bit_pos to the right edge of the byte: 0x0ff >> bit_pos */
+      bit_pos = 8-bit_pos;	/* number of pixel in the head byte */
+      if ( len < bit_pos )
       {
-	mask = 128;
-        ptr++;
+	/* the line ends within the head byte, remove the pixel right of the line */
+	mask >>= bit_pos-len;
+	mask <<= bit_pos-len;
+	bit_pos = len;
       }
-      
-      //x++;
-      len--;
-    } while( len != 0 );
+      u8g2_ll_apply_mask(ptr, mask, color);
+      len -= bit_pos;
+      if ( len == 0 )
+	return;
+      ptr++;
+    }
+    
+    byte_cnt = len;
+    byte_cnt >>= 3;
+    if ( byte_cnt != 0 )
+    {
+      if ( color == 1 )
+      {
+	memset(ptr, 0x0ff, byte_cnt);
+      }
+      else if ( color == 0 )
+      {
+	memset(ptr, 0, byte_cnt);
+      }
+      else
+      {
+	for( offset = 0; offset < byte_cnt; offset++ )
+	  ptr[offset] ^= 0x0ff;
+      }
+      ptr += byte_cnt;
+    }
+    
+    len &= 7;
+    if ( len != 0 )
+    {
+      mask = 0x0ff;
+      mask <<= 8-len;		/* remaining pixel at the left side of the tail byte */
+      u8g2_ll_apply_mask(ptr, mask, color);
+    }
   }
   else
   {
     do
     {
-      if ( u8g2->draw_color <= 1 )
-	*ptr |= mask;
-      if ( u8g2->draw_color != 1 )
-	*ptr ^= mask;
-      
+      u8g2_ll_apply_mask(ptr, mask, color);
       ptr += tile_width;
       //y++;
       len--;
@@ -298,6 +431,110 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
   }
 }
 
+void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_horizontal_right_lsb_color(u8g2, x, y, len, dir, u8g2->draw_color);
+}
+
+#ifdef U8G2_WITH_HVLINE_COLOR_SPECIALIZATION
+void u8g2_ll_hvline_horizontal_right_lsb_and_not(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_horizontal_right_lsb_color(u8g2, x, y, len, dir, 0);
+}
+
+void u8g2_ll_hvline_horizontal_right_lsb_or(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_horizontal_right_lsb_color(u8g2, x, y, len, dir, 1);
+}
+
+void u8g2_ll_hvline_horizontal_right_lsb_xor(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_horizontal_right_lsb_color(u8g2, x, y, len, dir, 2);
+}
+#endif /* U8G2_WITH_HVLINE_COLOR_SPECIALIZATION */
+
+#ifdef U8G2_WITH_LL_BOX
+/*
+  x,y		Upper left position of the box within the local buffer (not the display!)
+  w,h		width and height of the box, both must not be 0
+  color	draw color (see u8g2_ll_apply_mask)
+  
+  The masks for the left and right partial byte and the number of full bytes
+  are calculated once and then applied to each pixel row of the box.
+*/
+static U8G2_ALWAYS_INLINE void u8g2_ll_box_horizontal_right_lsb_color(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, uint8_t color)
+{
+  size_t offset;
+  uint8_t *ptr;
+  uint8_t bit_pos;
+  uint8_t head_mask, tail_mask;
+  uint16_t byte_cnt, i;
+  uint8_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
+  offset *= tile_width;
+  offset += x>>3;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+  
+  bit_pos = x;
+  bit_pos &= 7;
+  head_mask = 0;
+  if ( bit_pos != 0 )
+  {
+    head_mask = 0x0ff >> bit_pos;		/* pixel from bit_pos to the right edge of the byte */
+    bit_pos = 8-bit_pos;			/* number of pixel in the head byte */
+    if ( w <= bit_pos )
+    {
+      /* the box ends within the head byte */
+      head_mask >>= bit_pos-w;
+      head_mask <<= bit_pos-w;
+      w = 0;
+    }
+    else
+    {
+      w -= bit_pos;
+    }
+  }
+  byte_cnt = w >> 3;
+  tail_mask = 0x0ff << (8-(w&7));	/* remaining pixel at the left side of the tail byte, 0 if there is no tail */
+  
+  do
+  {
+    uint8_t *p = ptr;
+    if ( head_mask != 0 )
+    {
+      u8g2_ll_apply_mask(p, head_mask, color);
+      p++;
+    }
+    if ( color == 1 )
+      memset(p, 0x0ff, byte_cnt);
+    else if ( color == 0 )
+      memset(p, 0, byte_cnt);
+    else
+      for( i = 0; i < byte_cnt; i++ )
+	p[i] ^= 0x0ff;
+    p += byte_cnt;
+    if ( tail_mask != 0 )
+      u8g2_ll_apply_mask(p, tail_mask, color);
+    ptr += tile_width;
+    h--;
+  } while( h != 0 );
+}
+
+void u8g2_ll_box_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  /* expand the inner loop for each draw color */
+  if ( u8g2->draw_color == 0 )
+    u8g2_ll_box_horizontal_right_lsb_color(u8g2, x, y, w, h, 0);
+  else if ( u8g2->draw_color == 1 )
+    u8g2_ll_box_horizontal_right_lsb_color(u8g2, x, y, w, h, 1);
+  else
+    u8g2_ll_box_horizontal_right_lsb_color(u8g2, x, y, w, h, 2);
+}
+#endif /* U8G2_WITH_LL_BOX */
+
+
 #else /* U8G2_WITH_HVLINE_SPEED_OPTIMIZATION */
 
 
@@ -307,7 +544,7 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
 static void u8g2_draw_pixel_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y)
 {
-  uint16_t offset;
+  size_t offset;
   uint8_t *ptr;
   uint8_t bit_pos, mask;
 
@@ -323,7 +560,7 @@ static void u8g2_draw_pixel_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8
   mask >>= bit_pos;
   x >>= 3;
 
-  offset = y;		/* y might be 8 or 16 bit, but we need 16 bit, so use a 16 bit variable */
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
   offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
   offset += x;
   ptr = u8g2->tile_buf_ptr;
@@ -369,3 +606,300 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
 }
 
 #endif /* U8G2_WITH_HVLINE_SPEED_OPTIMIZATION */
+
+/*=================================================*/
+/*
+  u8g2_ll_hvline_horizontal_gray4
+  u8g2_ll_hvline_horizontal_gray2
+    SSD1322, SSD1327, SH1122 native gray buffer
+    
+  Each pixel row has tile_width*bpp bytes, the leftmost pixel is stored in the upper bits 
+  of a byte. This is the memory layout of the 4 bit gray level controllers, so
+  the buffer can be sent without conversion (U8X8_MSG_DISPLAY_DRAW_GRAY_TILE).
+  
+  draw_color:
+    0			gray level 0
+    1			highest gray level
+    2			invert the gray level (xor)
+    16..31		gray level 0..15, see U8G2_DRAW_COLOR_GRAY()
+*/
+
+#ifdef U8G2_WITH_GRAY_BUFFER
+
+static U8G2_ALWAYS_INLINE void u8g2_ll_hvline_horizontal_gray(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir, uint8_t bpp)
+{
+  size_t offset;
+  uint8_t *ptr;
+  uint8_t pixel_mask = (1<<bpp)-1;	/* 0x0f or 0x03 */
+  uint8_t ppb_mask = (8/bpp)-1;	/* pixel per byte minus 1: 1 or 3 */
+  uint8_t color = u8g2->draw_color;
+  uint8_t value, mask, shift, is_xor;
+  uint16_t stride;
+  
+  /* value: gray level replicated to all pixel of a byte */
+  is_xor = 0;
+  if ( color == 0 )
+    value = 0;
+  else if ( u8g2_is_gray_draw_color(color) )
+    value = (color & 0x0f) >> (4-bpp);
+  else
+  {
+    value = pixel_mask;
+    if ( color == 2 )
+      is_xor = 1;
+  }
+  if ( bpp == 4 )
+    value *= 0x11;
+  else
+    value *= 0x55;
+  
+  stride = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  stride *= bpp;
+  
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
+  offset *= stride;
+  offset += x / (ppb_mask+1);
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+  
+  if ( dir == 0 )
+  {
+    /* leading pixel of the first byte */
+    while( (x & ppb_mask) != 0 )
+    {
+      shift = (ppb_mask - (x & ppb_mask))*bpp;
+      mask = pixel_mask << shift;
+      if ( is_xor )
+	*ptr ^= mask;
+      else
+	*ptr = (*ptr & ~mask) | (value & mask);
+      x++;
+      len--;
+      if ( len == 0 )
+	return;
+      if ( (x & ppb_mask) == 0 )
+	ptr++;
+    }
+    
+    /* complete bytes */
+    offset = len / (ppb_mask+1);
+    if ( is_xor )
+    {
+      while( offset > 0 )
+      {
+	*ptr++ ^= 0x0ff;
+	offset--;
+      }
+    }
+    else
+    {
+      memset(ptr, value, offset);
+      ptr += offset;
+    }
+    
+    /* remaining pixel, left aligned in the last byte */
+    len &= ppb_mask;
+    if ( len != 0 )
+    {
+      mask = 0x0ff << ((ppb_mask + 1 - len)*bpp);
+      if ( is_xor )
+	*ptr ^= mask;
+      else
+	*ptr = (*ptr & ~mask) | (value & mask);
+    }
+  }
+  else
+  {
+    shift = (ppb_mask - (x & ppb_mask))*bpp;
+    mask = pixel_mask << shift;
+    value &= mask;
+    do
+    {
+      if ( is_xor )
+	*ptr ^= mask;
+      else
+	*ptr = (*ptr & ~mask) | value;
+      ptr += stride;
+      len--;
+    } while( len != 0 );
+  }
+}
+
+void u8g2_ll_hvline_horizontal_gray4(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_horizontal_gray(u8g2, x, y, len, dir, 4);
+}
+
+void u8g2_ll_hvline_horizontal_gray2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_ll_hvline_horizontal_gray(u8g2, x, y, len, dir, 2);
+}
+
+#ifdef U8G2_WITH_LL_BOX
+/* the horizontal gray line is mostly a memset, so just draw one line for each row of the box */
+void u8g2_ll_box_horizontal_gray4(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  do
+  {
+    u8g2_ll_hvline_horizontal_gray(u8g2, x, y, w, 0, 4);
+    y++;
+    h--;
+  } while( h != 0 );
+}
+
+void u8g2_ll_box_horizontal_gray2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  do
+  {
+    u8g2_ll_hvline_horizontal_gray(u8g2, x, y, w, 0, 2);
+    y++;
+    h--;
+  } while( h != 0 );
+}
+#endif /* U8G2_WITH_LL_BOX */
+
+#endif /* U8G2_WITH_GRAY_BUFFER */
+
+/*=================================================*/
+/* draw color specific hvline procedures */
+
+#ifdef U8G2_WITH_HVLINE_COLOR_SPECIALIZATION
+
+/* index into the list is the draw color (0, 1 or 2) */
+static const u8g2_draw_ll_hvline_cb u8g2_ll_hvline_vertical_top_lsb_color_list[3] = 
+{
+  u8g2_ll_hvline_vertical_top_lsb_and_not,
+  u8g2_ll_hvline_vertical_top_lsb_or,
+  u8g2_ll_hvline_vertical_top_lsb_xor
+};
+
+static const u8g2_draw_ll_hvline_cb u8g2_ll_hvline_horizontal_right_lsb_color_list[3] = 
+{
+  u8g2_ll_hvline_horizontal_right_lsb_and_not,
+  u8g2_ll_hvline_horizontal_right_lsb_or,
+  u8g2_ll_hvline_horizontal_right_lsb_xor
+};
+
+/*
+  Return the list of draw color specific procedures for the generic
+  low level hvline procedure "ll_hvline_cb" or NULL if there are no such
+  procedures (e.g. a hvline procedure of the user). 
+  Called by u8g2_SetupBuffer().
+*/
+const u8g2_draw_ll_hvline_cb *u8g2_ll_hvline_get_color_list(u8g2_draw_ll_hvline_cb ll_hvline_cb)
+{
+  if ( ll_hvline_cb == u8g2_ll_hvline_vertical_top_lsb )
+    return u8g2_ll_hvline_vertical_top_lsb_color_list;
+  if ( ll_hvline_cb == u8g2_ll_hvline_horizontal_right_lsb )
+    return u8g2_ll_hvline_horizontal_right_lsb_color_list;
+  return NULL;
+}
+
+#endif /* U8G2_WITH_HVLINE_COLOR_SPECIALIZATION */
+
+#ifdef U8G2_WITH_LL_BOX
+/*
+  Return the low level box procedure for the buffer layout of the low level 
+  hvline procedure "ll_hvline_cb" or NULL (u8g2_DrawBox() will then draw 
+  the box with hvlines). Called by u8g2_SetupBuffer().
+*/
+u8g2_draw_ll_box_cb u8g2_ll_box_get(u8g2_draw_ll_hvline_cb ll_hvline_cb)
+{
+  if ( ll_hvline_cb == u8g2_ll_hvline_vertical_top_lsb )
+    return u8g2_ll_box_vertical_top_lsb;
+  if ( ll_hvline_cb == u8g2_ll_hvline_horizontal_right_lsb )
+    return u8g2_ll_box_horizontal_right_lsb;
+#ifdef U8G2_WITH_GRAY_BUFFER
+  if ( ll_hvline_cb == u8g2_ll_hvline_horizontal_gray4 )
+    return u8g2_ll_box_horizontal_gray4;
+  if ( ll_hvline_cb == u8g2_ll_hvline_horizontal_gray2 )
+    return u8g2_ll_box_horizontal_gray2;
+#endif
+  return NULL;
+}
+#endif /* U8G2_WITH_LL_BOX */
+
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+/*
+  get 8 bits of a bitmap column, starting at bit position pos,
+  bits outside of the column are 0
+*/
+static uint8_t u8g2_ll_bitmap_get_byte(const uint8_t *column, int16_t pos, uint8_t bytes_per_column)
+{
+  uint8_t i, shift, v;
+  if ( pos < 0 )
+    return column[0] << (-pos);
+  i = pos >> 3;
+  shift = pos & 7;
+  v = 0;
+  if ( i < bytes_per_column )
+    v = column[i] >> shift;
+  i++;
+  if ( shift != 0 && i < bytes_per_column )
+    v |= column[i] << (8-shift);
+  return v;
+}
+
+/*
+  The bitmap is copied page by page: For each page, 8 bits of each
+  bitmap column are shifted to the page position and the mask for the 
+  page is applied.
+*/
+void u8g2_ll_bitmap_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, u8g2_uint_t bitmap_y, uint8_t bytes_per_column)
+{
+  size_t offset;
+  uint8_t *ptr;
+  const uint8_t *column;
+  uint8_t bit_pos, mask, v;
+  int16_t pos;
+  u8g2_uint_t i;
+  uint8_t color = u8g2->draw_color;
+  
+  bit_pos = y;
+  bit_pos &= 7;
+  
+  offset = y;		/* y might be 8 or 16 bit, the buffer might be larger than 64KB, so use size_t */
+  offset &= ~7;
+  offset *= u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += offset;
+  ptr += x;
+  
+  pos = bitmap_y;
+  pos -= bit_pos;		/* bitmap position of bit 0 of the current page */
+  mask = 0x0ff;
+  mask <<= bit_pos;		/* pixel from bit_pos to the lower edge of the page */
+  bit_pos = 8-bit_pos;	/* number of pixel rows in the first page */
+  for(;;)
+  {
+    if ( h < bit_pos )
+      mask &= 0x0ff >> (bit_pos-h);	/* the bitmap ends within this page */
+    column = bitmap;
+    for( i = 0; i < w; i++ )
+    {
+      v = u8g2_ll_bitmap_get_byte(column, pos, bytes_per_column) & mask;
+      if ( color == 0 )
+	ptr[i] &= ~v;
+      else if ( color == 1 )
+	ptr[i] |= v;
+      else
+	ptr[i] ^= v;
+      column += bytes_per_column;
+    }
+    if ( h <= bit_pos )
+      break;
+    h -= bit_pos;
+    pos += 8;
+    bit_pos = 8;
+    mask = 0x0ff;
+    ptr += u8g2_GetU8x8(u8g2)->display_info->tile_width*8;
+  }
+}
+
+u8g2_draw_ll_bitmap_cb u8g2_ll_bitmap_get(u8g2_draw_ll_hvline_cb ll_hvline_cb)
+{
+  if ( ll_hvline_cb == u8g2_ll_hvline_vertical_top_lsb )
+    return u8g2_ll_bitmap_vertical_top_lsb;
+  return NULL;
+}
+#endif /* U8G2_WITH_FONT_BITMAP_CACHE */
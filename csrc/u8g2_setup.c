@@ -51,6 +51,10 @@ void u8g2_SetMaxClipWindow(u8g2_t *u8g2)
   u8g2->clip_y1 = (u8g2_uint_t)~(u8g2_uint_t)0;
   
   u8g2->cb->update_page_win(u8g2);
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_is_dlist_record(u8g2) )
+    u8g2_dlist_add_clip(u8g2);
+#endif
 }
 
 void u8g2_SetClipWindow(u8g2_t *u8g2, u8g2_uint_t clip_x0, u8g2_uint_t clip_y0, u8g2_uint_t clip_x1, u8g2_uint_t clip_y1 )
@@ -60,6 +64,10 @@ void u8g2_SetClipWindow(u8g2_t *u8g2, u8g2_uint_t clip_x0, u8g2_uint_t clip_y0,
   u8g2->clip_x1 = clip_x1;
   u8g2->clip_y1 = clip_y1;
   u8g2->cb->update_page_win(u8g2);
+#ifdef U8G2_WITH_DISPLAY_LIST
+  if ( u8g2_is_dlist_record(u8g2) )
+    u8g2_dlist_add_clip(u8g2);
+#endif
 }
 #endif
 
@@ -71,17 +79,72 @@ void u8g2_SetClipWindow(u8g2_t *u8g2, u8g2_uint_t clip_x0, u8g2_uint_t clip_y0,
 void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_draw_ll_hvline_cb ll_hvline_cb, const u8g2_cb_t *u8g2_cb)
 {
   u8g2->font = NULL;
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+  u8g2->font_glyph_index = NULL;
+  u8g2->font_glyph_index_font = NULL;
+#endif
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+  u8g2->font_glyph_cache = NULL;
+  u8g2->font_glyph_cache_mask = 0;
+#endif
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+  u8g2->str_width_cache = NULL;
+  u8g2->str_width_cache_mask = 0;
+  u8g2->str_width_cache_hit_cnt = 0;
+  u8g2->str_width_cache_miss_cnt = 0;
+#endif
+#ifdef U8G2_WITH_KERNING_CACHE
+  u8g2->kerning_cache = NULL;
+  u8g2->kerning_cache_mask = 0;
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+  u8g2->font_bitmap_cache = NULL;
+  u8g2->font_bitmap_cache_cnt = 0;
+  u8g2->font_bitmap_cache_clock = 0;
+#endif
   //u8g2->kerning = NULL;
   //u8g2->get_kerning_cb = u8g2_GetNullKerning;
   
   //u8g2->ll_hvline = u8g2_ll_hvline_vertical_top_lsb;
   u8g2->ll_hvline = ll_hvline_cb;
+#ifdef U8G2_WITH_HVLINE_COLOR_SPECIALIZATION
+  u8g2->ll_hvline_color_list = u8g2_ll_hvline_get_color_list(ll_hvline_cb);
+#endif
+#ifdef U8G2_WITH_LL_BOX
+  u8g2->ll_box = u8g2_ll_box_get(ll_hvline_cb);
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+  u8g2->ll_bitmap = u8g2_ll_bitmap_get(ll_hvline_cb);
+#endif
   
   u8g2->tile_buf_ptr = buf;
   u8g2->tile_buf_height = tile_buf_height;
+#ifdef U8G2_WITH_GRAY_BUFFER
+  u8g2->bits_per_pixel = 1;
+#endif
   
   u8g2->tile_curr_row = 0;
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2->dirty_tile_buf = NULL;
+  u8g2->dirty_bytes_saved = 0;
+#endif
+#ifdef U8G2_WITH_DISPLAY_LIST
+  u8g2->dlist_buf = NULL;
+  u8g2->dlist_size = 0;
+  u8g2->dlist_pos = 0;
+  u8g2->dlist_state = U8G2_DLIST_STATE_OFF;
+#endif
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  u8g2->shadow_buf = NULL;
+  u8g2->shadow_changed_tiles = 0;
+  u8g2->shadow_frame_tiles = 0;
+#endif
+#ifdef U8G2_WITH_INCREMENTAL_SEND
+  u8g2->send_row = 255;
+  u8g2->send_tx = 0;
+#endif
+  
   u8g2->font_decode.is_transparent = 0; /* issue 443 */
   u8g2->bitmap_transparency = 0;
   
@@ -115,6 +178,22 @@ void u8g2_SetDisplayRotation(u8g2_t *u8g2, const u8g2_cb_t *u8g2_cb)
   u8g2->cb->update_page_win(u8g2);
 }
 
+#ifdef U8G2_WITH_GRAY_BUFFER
+/*
+  Setup a native gray level buffer for SSD1322, SSD1327 and SH1122.
+  bits_per_pixel must be 2 or 4. The buffer layout matches the display RAM of these
+  controllers, see u8g2_ll_hvline_horizontal_gray4()
+*/
+void u8g2_SetupGrayBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, uint8_t bits_per_pixel, const u8g2_cb_t *u8g2_cb)
+{
+  if ( bits_per_pixel == 2 )
+    u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_horizontal_gray2, u8g2_cb);
+  else
+    u8g2_SetupBuffer(u8g2, buf, tile_buf_height, u8g2_ll_hvline_horizontal_gray4, u8g2_cb);
+  u8g2->bits_per_pixel = bits_per_pixel == 2 ? 2 : 4;
+}
+#endif
+
 /*============================================*/
 
 void u8g2_SendF(u8g2_t * u8g2, const char *fmt, ...)
@@ -445,13 +524,78 @@ void u8g2_draw_l90_r3(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t le
 
 
 /*============================================*/
-const u8g2_cb_t u8g2_cb_r0 = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_r0 };
-const u8g2_cb_t u8g2_cb_r1 = { u8g2_update_dimension_r1, u8g2_update_page_win_r1, u8g2_draw_l90_r1 };
-const u8g2_cb_t u8g2_cb_r2 = { u8g2_update_dimension_r2, u8g2_update_page_win_r2, u8g2_draw_l90_r2 };
-const u8g2_cb_t u8g2_cb_r3 = { u8g2_update_dimension_r3, u8g2_update_page_win_r3, u8g2_draw_l90_r3 };
+/* 
+  box rotation: x, y, w, h are clipped against the user window, 
+  the rotated box is passed to u8g2_draw_box_2dir()
+*/
+#ifdef U8G2_WITH_LL_BOX
+
+void u8g2_draw_b90_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_draw_box_2dir(u8g2, x, y, w, h);
+}
+
+void u8g2_draw_b90_mirror_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t xx;
+  xx = u8g2->width;
+  xx -= x;
+  xx -= w;
+  u8g2_draw_box_2dir(u8g2, xx, y, w, h);
+}
+
+void u8g2_draw_b90_mirror_vertical_r0(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t yy;
+  yy = u8g2->height;
+  yy -= y;
+  yy -= h;
+  u8g2_draw_box_2dir(u8g2, x, yy, w, h);
+}
+
+void u8g2_draw_b90_r1(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t xx;
+  xx = u8g2->height;
+  xx -= y;
+  xx -= h;
+  u8g2_draw_box_2dir(u8g2, xx, x, h, w);
+}
+
+void u8g2_draw_b90_r2(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t xx, yy;
+  xx = u8g2->width;
+  xx -= x;
+  xx -= w;
+  yy = u8g2->height;
+  yy -= y;
+  yy -= h;
+  u8g2_draw_box_2dir(u8g2, xx, yy, w, h);
+}
+
+void u8g2_draw_b90_r3(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t yy;
+  yy = u8g2->width;
+  yy -= x;
+  yy -= w;
+  u8g2_draw_box_2dir(u8g2, y, yy, h, w);
+}
+
+#define U8G2_DRAW_B90(proc) , proc
+#else
+#define U8G2_DRAW_B90(proc)
+#endif /* U8G2_WITH_LL_BOX */
+
+/*============================================*/
+const u8g2_cb_t u8g2_cb_r0 = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_r0 U8G2_DRAW_B90(u8g2_draw_b90_r0) };
+const u8g2_cb_t u8g2_cb_r1 = { u8g2_update_dimension_r1, u8g2_update_page_win_r1, u8g2_draw_l90_r1 U8G2_DRAW_B90(u8g2_draw_b90_r1) };
+const u8g2_cb_t u8g2_cb_r2 = { u8g2_update_dimension_r2, u8g2_update_page_win_r2, u8g2_draw_l90_r2 U8G2_DRAW_B90(u8g2_draw_b90_r2) };
+const u8g2_cb_t u8g2_cb_r3 = { u8g2_update_dimension_r3, u8g2_update_page_win_r3, u8g2_draw_l90_r3 U8G2_DRAW_B90(u8g2_draw_b90_r3) };
   
-const u8g2_cb_t u8g2_cb_mirror = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_mirrorr_r0 };
-const u8g2_cb_t u8g2_cb_mirror_vertical = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_mirror_vertical_r0 };
+const u8g2_cb_t u8g2_cb_mirror = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_l90_mirrorr_r0 U8G2_DRAW_B90(u8g2_draw_b90_mirror_r0) };
+const u8g2_cb_t u8g2_cb_mirror_vertical = { u8g2_update_dimension_r0, u8g2_update_page_win_r0, u8g2_draw_mirror_vertical_r0 U8G2_DRAW_B90(u8g2_draw_b90_mirror_vertical_r0) };
   
 /*============================================*/
 /* setup for the null device */
@@ -44,6 +44,8 @@
     U8X8_MSG_DISPLAY_SET_POWER_SAVE
     U8X8_MSG_DISPLAY_SET_CONTRAST
     U8X8_MSG_DISPLAY_DRAW_TILE
+    U8X8_MSG_DISPLAY_DRAW_GRAY_TILE		optional, only gray level controller
+    U8X8_MSG_DISPLAY_DRAW_FULL_FRAME		optional
 
   A display driver may decided to breakdown these messages to a lower level interface or
   implement this functionality directly.
@@ -204,6 +206,35 @@ uint8_t u8x8_pgm_read_esp(const uint8_t * addr);   /* u8x8_8x8.c */
 #define U8X8_WITH_USER_PTR
 #endif
 
+/* 32 bit environments, some optimizations are enabled for these systems only (see also U8G2_32BIT_PLATFORM) */
+#if defined(unix) || defined(__unix__) || defined(__arm__) || defined(__xtensa__) || defined(xtensa) || defined(__arc__) || defined(ESP8266) || defined(ESP_PLATFORM) || defined(__LUATOS__)
+#define U8X8_32BIT_PLATFORM
+#endif
+
+/* 
+  Transfer segments (u8x8_cad_SendSegments, U8X8_MSG_BYTE_SEND_SEGMENTS): 
+  Display procedures collect the commands and data of one 
+  U8X8_MSG_DISPLAY_DRAW_TILE message in a segment list, which is passed 
+  to the byte procedure with one message. Enabled for 32 bit systems only.
+  Only u8x8_cad_110, u8x8_cad_100, u8x8_cad_001 and u8x8_cad_011 pass the
+  list to the byte procedure. With all other cad procedures (for example 
+  the ssd13xx I2C procedures) u8x8_cad_SendSegments() sends each segment 
+  with the usual command, arg and data messages.
+*/
+#ifdef U8X8_32BIT_PLATFORM
+#ifndef U8X8_WITHOUT_SEGMENTS
+#define U8X8_WITH_SEGMENTS
+#endif
+#endif
+
+/*
+  Full frame upload (u8x8_DrawFullFrame, U8X8_MSG_DISPLAY_DRAW_FULL_FRAME):
+  Display procedures, which support the message, set u8x8->is_full_frame in
+  U8X8_MSG_DISPLAY_SETUP_MEMORY. Used by u8g2_SendBuffer().
+  Disabled by default, define U8X8_WITH_FULL_FRAME to enable it.
+*/
+//#define U8X8_WITH_FULL_FRAME
+
 /*==========================================*/
 /* U8X8 typedefs and data structures */
 
@@ -211,6 +242,8 @@ uint8_t u8x8_pgm_read_esp(const uint8_t * addr);   /* u8x8_8x8.c */
 typedef struct u8x8_struct u8x8_t;
 typedef struct u8x8_display_info_struct u8x8_display_info_t;
 typedef struct u8x8_tile_struct u8x8_tile_t;
+typedef struct u8x8_segment_struct u8x8_segment_t;
+typedef struct u8x8_segment_list_struct u8x8_segment_list_t;
 
 typedef uint8_t (*u8x8_msg_cb)(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 typedef uint16_t (*u8x8_char_cb)(u8x8_t *u8x8, uint8_t b);
@@ -233,6 +266,31 @@ struct u8x8_tile_struct
   uint8_t y_pos;	/* tile y position */
 };
 
+/* one segment of a transfer, see U8X8_MSG_BYTE_SEND_SEGMENTS */
+struct u8x8_segment_struct
+{
+  uint8_t *data;	/* bytes of this segment */
+  uint8_t cnt;		/* number of bytes */
+  uint8_t msg;		/* U8X8_MSG_CAD_SEND_CMD, U8X8_MSG_CAD_SEND_ARG or U8X8_MSG_CAD_SEND_DATA */
+  uint8_t dc;		/* dc level for the byte procedure, assigned by the cad procedure */
+};
+
+#ifndef U8X8_SEGMENT_CNT
+#define U8X8_SEGMENT_CNT 16
+#endif
+#ifndef U8X8_SEGMENT_BYTE_CNT
+#define U8X8_SEGMENT_BYTE_CNT 16
+#endif
+
+/* segment list, which is built by u8x8_cad_SegmentCmd, u8x8_cad_SegmentArg and u8x8_cad_SegmentData */
+struct u8x8_segment_list_struct
+{
+  uint8_t cnt;					/* number of segments */
+  uint8_t byte_cnt;				/* used bytes of "bytes" */
+  u8x8_segment_t segment[U8X8_SEGMENT_CNT];
+  uint8_t bytes[U8X8_SEGMENT_BYTE_CNT];		/* storage for command and arg bytes */
+};
+
 
 struct u8x8_display_info_struct
 {
@@ -366,6 +424,12 @@ struct u8x8_struct
 #ifdef U8X8_WITH_USER_PTR
   void *user_ptr;
 #endif
+#ifdef U8X8_WITH_FULL_FRAME
+  uint8_t is_full_frame;	/* display_cb supports U8X8_MSG_DISPLAY_DRAW_FULL_FRAME, set by the display procedure in U8X8_MSG_DISPLAY_SETUP_MEMORY */
+#endif
+#ifdef U8X8_WITH_SEGMENTS
+  uint8_t is_byte_segments;	/* byte_cb supports U8X8_MSG_BYTE_SEND_SEGMENTS, set by the byte procedure in U8X8_MSG_BYTE_INIT */
+#endif
 #ifdef U8X8_USE_PINS 
   uint8_t pins[U8X8_PIN_CNT];	/* defines a pinlist: Mainly a list of pins for the Arduino Environment, use U8X8_PIN_xxx to access */
 #endif
@@ -435,6 +499,7 @@ struct u8log_struct
 /* helper functions */
 void u8x8_d_helper_display_setup_memory(u8x8_t *u8x8, const u8x8_display_info_t *display_info);
 void u8x8_d_helper_display_init(u8x8_t *u8g2);
+void u8x8_d_helper_send_gray_row(u8x8_t *u8x8, uint8_t bits_per_pixel, uint8_t cnt, const uint8_t *ptr);
 
 /* Display Interface */
 
@@ -533,6 +598,49 @@ void u8x8_d_helper_display_init(u8x8_t *u8g2);
 */
 #define U8X8_MSG_DISPLAY_REFRESH 16
 
+/*
+  Name: 	U8X8_MSG_DISPLAY_DRAW_GRAY_TILE
+  Args:	
+    arg_int: bits per pixel of the source buffer: 2 or 4
+    arg_ptr: pointer to u8x8_tile_t
+        uint8_t *tile_ptr;	pointer to the first pixel row of the first tile
+	uint8_t cnt;		number of tiles
+	uint8_t x_pos;		first tile x position
+	uint8_t y_pos;		first tile y position 
+  Tasks:
+    Write cnt horizontal tiles of a gray level buffer (8x8 pixel with 2 or 4 
+    bits per pixel). The buffer is organized in pixel rows, each pixel row has
+    display_info->tile_width*arg_int bytes. The leftmost pixel is stored in the
+    highest bits of a byte. One tile row starts at tile_ptr, tile_ptr+stride, ...
+    
+    This message is only supported by gray level controllers, which can
+    use the memory without conversion (SSD1322, SSD1327, SH1122).
+    Returns 0 if the message is not supported.
+    Use
+      uint8_t u8x8_DrawGrayTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t bits_per_pixel, uint8_t *tile_ptr)
+    to send the message to the display handler.
+*/
+#define U8X8_MSG_DISPLAY_DRAW_GRAY_TILE 17
+
+/*
+  Name: 	U8X8_MSG_DISPLAY_DRAW_FULL_FRAME
+  Args:	
+    arg_int: -
+    arg_ptr: pointer to the first tile of the frame
+  Tasks:
+    Write the complete display memory: display_info->tile_height tile rows
+    with display_info->tile_width tiles each, the tile rows follow each other
+    in memory (same tile format as U8X8_MSG_DISPLAY_DRAW_TILE).
+    This is the content of a full frame buffer. The controller may use
+    an auto increment mode to receive all tiles with a single data transfer.
+    Only sent if the display procedure has set u8x8->is_full_frame, 
+    otherwise U8X8_MSG_DISPLAY_DRAW_TILE must be used. Requires U8X8_WITH_FULL_FRAME.
+    Use
+      uint8_t u8x8_DrawFullFrame(u8x8_t *u8x8, uint8_t *tile_ptr)
+    to send the message to the display handler.
+*/
+#define U8X8_MSG_DISPLAY_DRAW_FULL_FRAME 18
+
 /*==========================================*/
 /* u8x8_setup.c */
 
@@ -551,6 +659,10 @@ void u8x8_Setup(u8x8_t *u8x8, u8x8_msg_cb display_cb, u8x8_msg_cb cad_cb, u8x8_m
 /*==========================================*/
 /* u8x8_display.c */
 uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr);
+uint8_t u8x8_DrawGrayTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t bits_per_pixel, uint8_t *tile_ptr);
+#ifdef U8X8_WITH_FULL_FRAME
+uint8_t u8x8_DrawFullFrame(u8x8_t *u8x8, uint8_t *tile_ptr);
+#endif
 
 /* 
   After a call to u8x8_SetupDefaults, 
@@ -611,6 +723,9 @@ void u8x8_ClearLine(u8x8_t *u8x8, uint8_t line);
 /* arg_int = 0: disable chip, arg_int = 1: enable chip */
 //#define U8X8_MSG_CAD_SET_I2C_ADR 26
 //#define U8X8_MSG_CAD_SET_DEVICE 27
+#define U8X8_MSG_CAD_SEND_SEGMENTS 28
+/* arg_int: number of segments, arg_ptr: u8x8_segment_t array */
+/* returns 0 if not supported, see u8x8_cad_SendSegments() */
 
 
 
@@ -625,6 +740,20 @@ uint8_t u8x8_cad_SendData(u8x8_t *u8x8, uint8_t cnt, uint8_t *data) U8X8_NOINLIN
 uint8_t u8x8_cad_StartTransfer(u8x8_t *u8x8) U8X8_NOINLINE;
 uint8_t u8x8_cad_EndTransfer(u8x8_t *u8x8) U8X8_NOINLINE;
 void u8x8_cad_vsendf(u8x8_t * u8x8, const char *fmt, va_list va);
+#ifdef U8X8_WITH_SEGMENTS
+void u8x8_cad_InitSegments(u8x8_segment_list_t *list);
+uint8_t u8x8_cad_SegmentCmd(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t cmd);
+uint8_t u8x8_cad_SegmentArg(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t arg);
+uint8_t u8x8_cad_SegmentData(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t cnt, uint8_t *data);
+uint8_t u8x8_cad_SendSegments(u8x8_t *u8x8, u8x8_segment_list_t *list) U8X8_NOINLINE;
+#else
+/* without segments, the commands, args and data are sent immediately */
+#define u8x8_cad_InitSegments(list) ((void)(list))
+#define u8x8_cad_SegmentCmd(u8x8, list, cmd) ((void)(list), u8x8_cad_SendCmd((u8x8), (cmd)))
+#define u8x8_cad_SegmentArg(u8x8, list, arg) ((void)(list), u8x8_cad_SendArg((u8x8), (arg)))
+#define u8x8_cad_SegmentData(u8x8, list, cnt, data) ((void)(list), u8x8_cad_SendData((u8x8), (cnt), (data)))
+#define u8x8_cad_SendSegments(u8x8, list) ((void)(u8x8), (void)(list))
+#endif
 void u8x8_SendF(u8x8_t * u8x8, const char *fmt, ...);
 
 /*
@@ -682,6 +811,18 @@ uint8_t u8x8_cad_uc1638_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *ar
 #define U8X8_MSG_BYTE_START_TRANSFER U8X8_MSG_CAD_START_TRANSFER
 #define U8X8_MSG_BYTE_END_TRANSFER U8X8_MSG_CAD_END_TRANSFER
 
+/*
+  U8X8_MSG_BYTE_SEND_SEGMENTS
+    arg_int: number of segments
+    arg_ptr: u8x8_segment_t array
+    Send the bytes of all segments, the dc member of each segment is the
+    dc level (see U8X8_MSG_BYTE_SET_DC). This message is only used if 
+    the byte procedure sets u8x8->is_byte_segments in U8X8_MSG_BYTE_INIT.
+    It is sent between U8X8_MSG_BYTE_START_TRANSFER and 
+    U8X8_MSG_BYTE_END_TRANSFER.
+*/
+#define U8X8_MSG_BYTE_SEND_SEGMENTS U8X8_MSG_CAD_SEND_SEGMENTS
+
 //#define U8X8_MSG_BYTE_SET_I2C_ADR U8X8_MSG_CAD_SET_I2C_ADR
 //#define U8X8_MSG_BYTE_SET_DEVICE U8X8_MSG_CAD_SET_DEVICE
 
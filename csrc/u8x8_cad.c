@@ -146,6 +146,144 @@ void u8x8_SendF(u8x8_t * u8x8, const char *fmt, ...)
   va_end(va);
 }
 
+#ifdef U8X8_WITH_SEGMENTS
+/*
+  Transfer segments: The commands, args and data of one transfer are 
+  collected in a segment list and sent with u8x8_cad_SendSegments().
+  Consecutive commands or args share one segment. The data is not 
+  copied, it must not change before u8x8_cad_SendSegments() is called.
+  
+    u8x8_segment_list_t list;
+    u8x8_cad_StartTransfer(u8x8);
+    u8x8_cad_InitSegments(&list);
+    u8x8_cad_SegmentCmd(u8x8, &list, cmd);
+    u8x8_cad_SegmentData(u8x8, &list, cnt, data);
+    u8x8_cad_SendSegments(u8x8, &list);
+    u8x8_cad_EndTransfer(u8x8);
+
+  The list is sent automatically if it is full.
+*/
+void u8x8_cad_InitSegments(u8x8_segment_list_t *list)
+{
+  list->cnt = 0;
+  list->byte_cnt = 0;
+}
+
+static uint8_t u8x8_cad_segment_byte(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t msg, uint8_t b)
+{
+  u8x8_segment_t *seg;
+  
+  if ( list->byte_cnt >= U8X8_SEGMENT_BYTE_CNT )
+    u8x8_cad_SendSegments(u8x8, list);
+  
+  seg = list->segment + list->cnt;
+  if ( list->cnt > 0 && seg[-1].msg == msg && seg[-1].data + seg[-1].cnt == list->bytes + list->byte_cnt )
+  {
+    seg--;	/* continue the previous segment */
+  }
+  else
+  {
+    if ( list->cnt >= U8X8_SEGMENT_CNT )
+    {
+      u8x8_cad_SendSegments(u8x8, list);
+      seg = list->segment;
+    }
+    seg->data = list->bytes + list->byte_cnt;
+    seg->cnt = 0;
+    seg->msg = msg;
+    list->cnt++;
+  }
+  list->bytes[list->byte_cnt++] = b;
+  seg->cnt++;
+  return 1;
+}
+
+uint8_t u8x8_cad_SegmentCmd(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t cmd)
+{
+  return u8x8_cad_segment_byte(u8x8, list, U8X8_MSG_CAD_SEND_CMD, cmd);
+}
+
+uint8_t u8x8_cad_SegmentArg(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t arg)
+{
+  return u8x8_cad_segment_byte(u8x8, list, U8X8_MSG_CAD_SEND_ARG, arg);
+}
+
+uint8_t u8x8_cad_SegmentData(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t cnt, uint8_t *data)
+{
+  u8x8_segment_t *seg;
+  
+  if ( cnt == 0 )
+    return 1;
+  seg = list->segment + list->cnt;
+  if ( list->cnt > 0 && seg[-1].msg == U8X8_MSG_CAD_SEND_DATA && seg[-1].data + seg[-1].cnt == data && seg[-1].cnt + cnt <= 255 )
+  {
+    seg[-1].cnt += cnt;	/* continue the previous segment */
+    return 1;
+  }
+  if ( list->cnt >= U8X8_SEGMENT_CNT )
+  {
+    u8x8_cad_SendSegments(u8x8, list);
+    seg = list->segment;
+  }
+  seg->data = data;
+  seg->cnt = cnt;
+  seg->msg = U8X8_MSG_CAD_SEND_DATA;
+  list->cnt++;
+  return 1;
+}
+
+/*
+  Send the segment list with U8X8_MSG_CAD_SEND_SEGMENTS. If either the cad 
+  or the byte procedure does not support this message, each segment is
+  sent with the U8X8_MSG_CAD_SEND_CMD/ARG/DATA messages.
+  The list is empty afterwards.
+*/
+uint8_t u8x8_cad_SendSegments(u8x8_t *u8x8, u8x8_segment_list_t *list)
+{
+  u8x8_segment_t *seg;
+  uint8_t i, j;
+  
+  if ( list->cnt > 0 )
+  {
+    if ( u8x8->is_byte_segments == 0 || u8x8->cad_cb(u8x8, U8X8_MSG_CAD_SEND_SEGMENTS, list->cnt, list->segment) == 0 )
+    {
+      seg = list->segment;
+      for( i = 0; i < list->cnt; i++ )
+      {
+	if ( seg->msg == U8X8_MSG_CAD_SEND_DATA )
+	{
+	  u8x8_cad_SendData(u8x8, seg->cnt, seg->data);
+	}
+	else
+	{
+	  for( j = 0; j < seg->cnt; j++ )
+	    u8x8->cad_cb(u8x8, seg->msg, seg->data[j], NULL);
+	}
+	seg++;
+      }
+    }
+  }
+  u8x8_cad_InitSegments(list);
+  return 1;
+}
+
+/* assign the dc level to each segment and pass the list to the byte procedure */
+static uint8_t u8x8_cad_send_segments(u8x8_t *u8x8, uint8_t cnt, u8x8_segment_t *seg, uint8_t dc_cmd, uint8_t dc_arg, uint8_t dc_data)
+{
+  uint8_t i;
+  for( i = 0; i < cnt; i++ )
+  {
+    if ( seg[i].msg == U8X8_MSG_CAD_SEND_CMD )
+      seg[i].dc = dc_cmd;
+    else if ( seg[i].msg == U8X8_MSG_CAD_SEND_ARG )
+      seg[i].dc = dc_arg;
+    else
+      seg[i].dc = dc_data;
+  }
+  return u8x8->byte_cb(u8x8, U8X8_MSG_BYTE_SEND_SEGMENTS, cnt, seg);
+}
+#endif /* U8X8_WITH_SEGMENTS */
+
 /*
   21 c		send command c
   22 a		send arg a
@@ -242,6 +380,10 @@ uint8_t u8x8_cad_110(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
     case U8X8_MSG_CAD_START_TRANSFER:
     case U8X8_MSG_CAD_END_TRANSFER:
       return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+#ifdef U8X8_WITH_SEGMENTS
+    case U8X8_MSG_CAD_SEND_SEGMENTS:
+      return u8x8_cad_send_segments(u8x8, arg_int, (u8x8_segment_t *)arg_ptr, 1, 1, 0);
+#endif
     default:
       return 0;
   }
@@ -321,6 +463,10 @@ uint8_t u8x8_cad_100(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
     case U8X8_MSG_CAD_START_TRANSFER:
     case U8X8_MSG_CAD_END_TRANSFER:
       return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+#ifdef U8X8_WITH_SEGMENTS
+    case U8X8_MSG_CAD_SEND_SEGMENTS:
+      return u8x8_cad_send_segments(u8x8, arg_int, (u8x8_segment_t *)arg_ptr, 1, 0, 0);
+#endif
     default:
       return 0;
   }
@@ -353,6 +499,10 @@ uint8_t u8x8_cad_001(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
     case U8X8_MSG_CAD_START_TRANSFER:
     case U8X8_MSG_CAD_END_TRANSFER:
       return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+#ifdef U8X8_WITH_SEGMENTS
+    case U8X8_MSG_CAD_SEND_SEGMENTS:
+      return u8x8_cad_send_segments(u8x8, arg_int, (u8x8_segment_t *)arg_ptr, 0, 0, 1);
+#endif
     default:
       return 0;
   }
@@ -385,6 +535,10 @@ uint8_t u8x8_cad_011(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
     case U8X8_MSG_CAD_START_TRANSFER:
     case U8X8_MSG_CAD_END_TRANSFER:
       return u8x8->byte_cb(u8x8, msg, arg_int, arg_ptr);
+#ifdef U8X8_WITH_SEGMENTS
+    case U8X8_MSG_CAD_SEND_SEGMENTS:
+      return u8x8_cad_send_segments(u8x8, arg_int, (u8x8_segment_t *)arg_ptr, 0, 1, 1);
+#endif
     default:
       return 0;
   }
@@ -177,6 +177,31 @@ uint8_t u8x8_d_sh1122_common(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *a
       }
 
       
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_DRAW_GRAY_TILE:
+      /* the buffer already has the sh1122 memory layout, only the row address has to be set for each pixel row */
+      u8x8_cad_StartTransfer(u8x8);
+      x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
+      x *= 4;		// 8 pixel per tile, 2 pixel per column address
+      x += u8x8->x_offset;		
+    
+      y = (((u8x8_tile_t *)arg_ptr)->y_pos);
+      y *= 8;
+      
+      c = ((u8x8_tile_t *)arg_ptr)->cnt;	/* number of tiles */
+      ptr = ((u8x8_tile_t *)arg_ptr)->tile_ptr;	/* data ptr to the first pixel row */
+      for( i = 0; i < 8; i++ )
+      {
+	u8x8_cad_SendCmd(u8x8, 0x0b0 );	/* set row address */
+	u8x8_cad_SendArg(u8x8, y);
+	u8x8_cad_SendCmd(u8x8, x & 15 );	/* lower 4 bit*/
+	u8x8_cad_SendCmd(u8x8, 0x010 | (x >> 4) );	/* higher 3 bit */	  
+	u8x8_d_helper_send_gray_row(u8x8, arg_int, c, ptr);
+	ptr += u8x8->display_info->tile_width*arg_int;
+	y++;
+      }
+      
       u8x8_cad_EndTransfer(u8x8);
       break;
     default:
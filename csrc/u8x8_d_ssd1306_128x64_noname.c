@@ -255,6 +255,7 @@ static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t
 {
   uint8_t x, c;
   uint8_t *ptr;
+  u8x8_segment_list_t list;
   switch(msg)
   {
     /* handled by the calling function
@@ -295,34 +296,29 @@ static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t
       break;
 #endif
     case U8X8_MSG_DISPLAY_DRAW_TILE:
+      /* collect the commands and the tile data, so that the byte procedure can send them at once (U8X8_WITH_SEGMENTS) */
       u8x8_cad_StartTransfer(u8x8);
+      u8x8_cad_InitSegments(&list);
       x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
       x *= 8;
       x += u8x8->x_offset;
     
-      u8x8_cad_SendCmd(u8x8, 0x040 );	/* set line offset to 0 */
+      u8x8_cad_SegmentCmd(u8x8, &list, 0x040 );	/* set line offset to 0 */
     
-      u8x8_cad_SendCmd(u8x8, 0x010 | (x>>4) );
-      u8x8_cad_SendArg(u8x8, 0x000 | ((x&15)));					/* probably wrong, should be SendCmd */
-      u8x8_cad_SendArg(u8x8, 0x0b0 | (((u8x8_tile_t *)arg_ptr)->y_pos));	/* probably wrong, should be SendCmd */
-
+      u8x8_cad_SegmentCmd(u8x8, &list, 0x010 | (x>>4) );
+      /* column low nibble and page are commands, but the ssd1306 cad procedures send args like commands */
+      u8x8_cad_SegmentArg(u8x8, &list, 0x000 | ((x&15)));
+      u8x8_cad_SegmentArg(u8x8, &list, 0x0b0 | (((u8x8_tile_t *)arg_ptr)->y_pos));
     
       do
       {
 	c = ((u8x8_tile_t *)arg_ptr)->cnt;
 	ptr = ((u8x8_tile_t *)arg_ptr)->tile_ptr;
-	u8x8_cad_SendData(u8x8, c*8, ptr); 	/* note: SendData can not handle more than 255 bytes */
-	/*
-	do
-	{
-	  u8x8_cad_SendData(u8x8, 8, ptr);
-	  ptr += 8;
-	  c--;
-	} while( c > 0 );
-	*/
+	u8x8_cad_SegmentData(u8x8, &list, c*8, ptr); 	/* note: SendData can not handle more than 255 bytes */
 	arg_int--;
       } while( arg_int > 0 );
       
+      u8x8_cad_SendSegments(u8x8, &list);
       u8x8_cad_EndTransfer(u8x8);
       break;
     default:
@@ -332,6 +328,57 @@ static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t
 }
 
 
+#ifdef U8X8_WITH_FULL_FRAME
+/*
+  Set the column and page window to the visible area, starting at column x.
+  The size of the area is taken from the display_info.
+*/
+static void u8x8_d_ssd1306_set_window(u8x8_t *u8x8, u8x8_segment_list_t *list, uint8_t x)
+{
+  u8x8_cad_SegmentCmd(u8x8, list, 0x021 );		/* column window */
+  u8x8_cad_SegmentArg(u8x8, list, x );
+  u8x8_cad_SegmentArg(u8x8, list, x + u8x8->display_info->tile_width*8 - 1 );
+  u8x8_cad_SegmentCmd(u8x8, list, 0x022 );		/* page window */
+  u8x8_cad_SegmentArg(u8x8, list, 0 );
+  u8x8_cad_SegmentArg(u8x8, list, u8x8->display_info->tile_height - 1 );
+}
+
+/*
+  U8X8_MSG_DISPLAY_DRAW_FULL_FRAME, SSD1306 only (not SH1106, SSD1312):
+  The init sequences select the horizontal addressing mode, so after the column
+  and page window has been set to the visible area, the complete frame is 
+  sent as one data stream. Afterwards the window is reset to the visible area
+  at the default x offset, this is the state after the init sequence, 
+  expected by DRAW_TILE.
+  The data is passed in blocks of 240 bytes: SendData can not handle more than
+  255 bytes and the I2C cad procedures split the data into 24 byte transfers.
+*/
+static uint8_t u8x8_d_ssd1306_draw_full_frame(u8x8_t *u8x8, uint8_t *ptr)
+{
+  uint16_t cnt;
+  uint8_t c;
+  u8x8_segment_list_t list;
+  
+  cnt = (uint16_t)u8x8->display_info->tile_width*8*u8x8->display_info->tile_height;
+  
+  u8x8_cad_StartTransfer(u8x8);
+  u8x8_cad_InitSegments(&list);
+  u8x8_cad_SegmentCmd(u8x8, &list, 0x040 );		/* set line offset to 0 */
+  u8x8_d_ssd1306_set_window(u8x8, &list, u8x8->x_offset);
+  while( cnt > 0 )
+  {
+    c = cnt > 240 ? 240 : cnt;
+    u8x8_cad_SegmentData(u8x8, &list, c, ptr);
+    ptr += c;
+    cnt -= c;
+  }
+  u8x8_d_ssd1306_set_window(u8x8, &list, u8x8->display_info->default_x_offset);
+  u8x8_cad_SendSegments(u8x8, &list);
+  u8x8_cad_EndTransfer(u8x8);
+  return 1;
+}
+#endif /* U8X8_WITH_FULL_FRAME */
+
 static const u8x8_display_info_t u8x8_ssd1306_128x64_noname_display_info =
 {
   /* chip_enable_level = */ 0,
@@ -370,7 +417,14 @@ uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
       break;
     case U8X8_MSG_DISPLAY_SETUP_MEMORY:
       u8x8_d_helper_display_setup_memory(u8x8, &u8x8_ssd1306_128x64_noname_display_info);
+#ifdef U8X8_WITH_FULL_FRAME
+      u8x8->is_full_frame = 1;
+#endif
       break;
+#ifdef U8X8_WITH_FULL_FRAME
+    case U8X8_MSG_DISPLAY_DRAW_FULL_FRAME:
+      return u8x8_d_ssd1306_draw_full_frame(u8x8, (uint8_t *)arg_ptr);
+#endif
     default:
       return 0;
   }
@@ -423,7 +477,14 @@ uint8_t u8x8_d_ssd1306_128x64_vcomh0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
       break;
     case U8X8_MSG_DISPLAY_SETUP_MEMORY:
       u8x8_d_helper_display_setup_memory(u8x8, &u8x8_ssd1306_128x64_noname_display_info);
+#ifdef U8X8_WITH_FULL_FRAME
+      u8x8->is_full_frame = 1;
+#endif
       break;
+#ifdef U8X8_WITH_FULL_FRAME
+    case U8X8_MSG_DISPLAY_DRAW_FULL_FRAME:
+      return u8x8_d_ssd1306_draw_full_frame(u8x8, (uint8_t *)arg_ptr);
+#endif
     default:
       return 0;
   }
@@ -444,7 +505,14 @@ uint8_t u8x8_d_ssd1306_128x64_alt0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
       break;
     case U8X8_MSG_DISPLAY_SETUP_MEMORY:
       u8x8_d_helper_display_setup_memory(u8x8, &u8x8_ssd1306_128x64_noname_display_info);
+#ifdef U8X8_WITH_FULL_FRAME
+      u8x8->is_full_frame = 1;
+#endif
       break;
+#ifdef U8X8_WITH_FULL_FRAME
+    case U8X8_MSG_DISPLAY_DRAW_FULL_FRAME:
+      return u8x8_d_ssd1306_draw_full_frame(u8x8, (uint8_t *)arg_ptr);
+#endif
     default:
       return 0;
   }
@@ -215,6 +215,33 @@ uint8_t u8x8_d_ssd1322_common(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *
 	arg_int--;
       } while( arg_int > 0 );
       
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_DRAW_GRAY_TILE:
+      /* the buffer already has the ssd1322 memory layout: write the 8 pixel rows as one window */
+      u8x8_cad_StartTransfer(u8x8);
+      x = ((u8x8_tile_t *)arg_ptr)->x_pos;    
+      x *= 2;		// only every 4th col can be addressed
+      x += u8x8->x_offset;		
+      c = ((u8x8_tile_t *)arg_ptr)->cnt;
+      ptr = ((u8x8_tile_t *)arg_ptr)->tile_ptr;
+      y = (((u8x8_tile_t *)arg_ptr)->y_pos);
+      y *= 8;
+      
+      u8x8_cad_SendCmd(u8x8, 0x075 );	/* set row address */
+      u8x8_cad_SendArg(u8x8, y);
+      u8x8_cad_SendArg(u8x8, y+7);
+      u8x8_cad_SendCmd(u8x8, 0x015 );	/* set column address */
+      u8x8_cad_SendArg(u8x8, x );	/* start */
+      u8x8_cad_SendArg(u8x8, x+c*2-1 );	/* end */
+      u8x8_cad_SendCmd(u8x8, 0x05c );	/* write to ram */
+      
+      for( y = 0; y < 8; y++ )
+      {
+	u8x8_d_helper_send_gray_row(u8x8, arg_int, c, ptr);
+	ptr += u8x8->display_info->tile_width*arg_int;
+      }
+      
       u8x8_cad_EndTransfer(u8x8);
       break;
     default:
@@ -76,6 +76,50 @@ void u8x8_d_helper_display_init(u8x8_t *u8x8)
       u8x8_gpio_Delay(u8x8, U8X8_MSG_DELAY_MILLI, u8x8->display_info->post_reset_wait_ms);
 }    
 
+/*
+  this is a helper function for the U8X8_MSG_DISPLAY_DRAW_GRAY_TILE message.
+  Send one pixel row of "cnt" tiles as 4 bit per pixel data (two pixel per byte, 
+  left pixel in the high nibble). 4 bit data is sent directly, 2 bit data is 
+  expanded to 4 bit: level 0..3 becomes 0, 5, 10, 15.
+  Must be called inside a transfer (u8x8_cad_StartTransfer).
+*/
+void u8x8_d_helper_send_gray_row(u8x8_t *u8x8, uint8_t bits_per_pixel, uint8_t cnt, const uint8_t *ptr)
+{
+  uint8_t buf[32];
+  uint8_t i, b;
+  uint16_t len;
+  
+  if ( bits_per_pixel == 4 )
+  {
+    len = cnt;
+    len *= 4;		/* 8 pixel, 4 byte per tile */
+    while( len > 128 )
+    {
+      u8x8_cad_SendData(u8x8, 128, (uint8_t *)ptr);
+      ptr += 128;
+      len -= 128;
+    }
+    u8x8_cad_SendData(u8x8, len, (uint8_t *)ptr);
+  }
+  else
+  {
+    len = cnt;
+    len *= 2;		/* 8 pixel, 2 byte per tile in the source buffer */
+    while( len > 0 )
+    {
+      i = 0;
+      while( i < sizeof(buf) && len > 0 )
+      {
+	b = *ptr++;
+	buf[i++] = (b >> 6)*0x50 + ((b >> 4) & 3)*5;
+	buf[i++] = ((b >> 2) & 3)*0x50 + (b & 3)*5;
+	len--;
+      }
+      u8x8_cad_SendData(u8x8, i, buf);
+    }
+  }
+}
+
 /*==========================================*/
 /* official functions */
 
@@ -89,6 +133,27 @@ uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *
   return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, (void *)&tile);
 }
 
+/* tile_ptr points into a gray level buffer with display_info->tile_width*bits_per_pixel bytes per pixel row */
+uint8_t u8x8_DrawGrayTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t bits_per_pixel, uint8_t *tile_ptr)
+{
+  u8x8_tile_t tile;
+  tile.x_pos = x;
+  tile.y_pos = y;
+  tile.cnt = cnt;
+  tile.tile_ptr = tile_ptr;
+  return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_GRAY_TILE, bits_per_pixel, (void *)&tile);
+}
+
+#ifdef U8X8_WITH_FULL_FRAME
+/* tile_ptr points to tile_width*tile_height tiles, returns 0 if the display does not support this (is_full_frame == 0) */
+uint8_t u8x8_DrawFullFrame(u8x8_t *u8x8, uint8_t *tile_ptr)
+{
+  if ( u8x8->is_full_frame == 0 )
+    return 0;
+  return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_FULL_FRAME, 0, (void *)tile_ptr);
+}
+#endif
+
 /* should be implemented as macro */
 void u8x8_SetupMemory(u8x8_t *u8x8)
 {
@@ -105,6 +105,12 @@ void u8x8_SetupDefaults(u8x8_t *u8x8)
     u8x8->bus_clock = 0;		/* issue 769 */
     u8x8->i2c_address = 255;
     u8x8->debounce_default_pin_state = 255;	/* assume all low active buttons */
+#ifdef U8X8_WITH_SEGMENTS
+    u8x8->is_byte_segments = 0;	/* set by the byte procedure */
+#endif
+#ifdef U8X8_WITH_FULL_FRAME
+    u8x8->is_full_frame = 0;	/* set by the display procedure */
+#endif
   
 #ifdef U8X8_USE_PINS 
   {
@@ -0,0 +1,126 @@
+/*
+ * Test send_buffer_async() and get_async_send_stats() without a display.
+ *
+ * A fake byte procedure records all bytes sent to the SSD1306 and is slow
+ * enough, so that the next frame is drawn while the transfer thread still
+ * sends the previous one. The recorded bytes must be the same as with
+ * u8g2_SendBuffer(). Returns 0 if all checks passed.
+ */
+
+#include "u8g2port.h"
+#include <string.h>
+
+#define FRAMES 20
+#define LOG_SIZE (FRAMES * 1200)
+
+// Bytes received by the fake byte procedure, the DC level is stored in bit 8
+static uint16_t log_buf[LOG_SIZE];
+static size_t log_cnt;
+static uint8_t log_dc;
+
+static int error_cnt;
+
+/*
+ * Fake byte procedure, called by the transfer thread during send_buffer_async().
+ */
+static uint8_t u8x8_byte_log(U8X8_UNUSED u8x8_t *u8x8, uint8_t msg,
+		uint8_t arg_int, void *arg_ptr) {
+	uint8_t *p = (uint8_t*) arg_ptr;
+
+	switch (msg) {
+	case U8X8_MSG_BYTE_SEND:
+		while (arg_int > 0) {
+			if (log_cnt < LOG_SIZE) {
+				log_buf[log_cnt] = *p | (log_dc << 8);
+			}
+			log_cnt++;
+			p++;
+			arg_int--;
+		}
+		// Slow bus: 128 bytes take about 1 ms
+		sleep_us(8 * (unsigned long) (p - (uint8_t*) arg_ptr));
+		break;
+	case U8X8_MSG_BYTE_SET_DC:
+		log_dc = arg_int;
+		break;
+	default:
+		break;
+	}
+	return 1;
+}
+
+static void check(int cond, const char *msg) {
+	if (!cond) {
+		printf("failed: %s\n", msg);
+		error_cnt++;
+	}
+}
+
+/*
+ * Draw FRAMES frames, each frame is drawn directly after the previous one
+ * has been passed to send_buffer_async().
+ */
+static void draw_frames(u8g2_t *u8g2) {
+	char s[16];
+
+	for (int i = 0; i < FRAMES; ++i) {
+		u8g2_ClearBuffer(u8g2);
+		u8g2_DrawBox(u8g2, i * 5, i * 2, 20, 10);
+		u8g2_DrawFrame(u8g2, 0, 0, 128, 64);
+		snprintf(s, sizeof(s), "Frame %d", i);
+		u8g2_DrawStr(u8g2, 10, 40, s);
+		send_buffer_async(u8g2);
+	}
+	wait_async_send(u8g2);
+}
+
+int main(void) {
+	static uint16_t sync_log[LOG_SIZE];
+	size_t sync_cnt;
+	unsigned long frames;
+	unsigned long long transfer_ns, wait_ns;
+	u8g2_t u8g2;
+
+	u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_log,
+			u8x8_dummy_cb);
+	init_user_data(&u8g2);
+	u8g2_InitDisplay(&u8g2);
+	u8g2_SetFont(&u8g2, u8g2_font_6x10_tf);
+
+	// Without init_async_send(): same as u8g2_SendBuffer(), no statistics
+	log_cnt = 0;
+	draw_frames(&u8g2);
+	sync_cnt = log_cnt;
+	memcpy(sync_log, log_buf, sizeof(sync_log));
+	get_async_send_stats(&u8g2, &frames, &transfer_ns, &wait_ns);
+	check(frames == 0 && transfer_ns == 0 && wait_ns == 0,
+			"statistics without init_async_send()");
+	check(sync_cnt > 0 && sync_cnt <= LOG_SIZE, "log size");
+
+	// With the transfer thread
+	check(init_async_send(&u8g2) == 0, "init_async_send()");
+	log_cnt = 0;
+	draw_frames(&u8g2);
+	check(log_cnt == sync_cnt, "number of bytes sent");
+	check(memcmp(log_buf, sync_log, sizeof(sync_log)) == 0, "bytes sent");
+	get_async_send_stats(&u8g2, &frames, &transfer_ns, &wait_ns);
+	printf("frames=%lu transfer=%llu us wait=%llu us\n", frames,
+			transfer_ns / 1000, wait_ns / 1000);
+	check(frames == FRAMES, "number of frames");
+	check(transfer_ns > 0, "transfer time");
+	// The next frame is drawn much faster than the transfer, so the renderer has to wait
+	check(wait_ns > 0, "wait time");
+
+	// After done_async_send() the statistics are reset
+	done_async_send(&u8g2);
+	get_async_send_stats(&u8g2, &frames, &transfer_ns, &wait_ns);
+	check(frames == 0, "statistics after done_async_send()");
+
+	done_user_data(&u8g2);
+	if (error_cnt == 0) {
+		printf("ok\n");
+	} else {
+		printf("%d errors\n", error_cnt);
+	}
+	return error_cnt != 0;
+}
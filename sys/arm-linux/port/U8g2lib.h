@@ -162,6 +162,18 @@ public:
 	void doneSpi(void) {
 		done_spi();
 	}
+	int initAsyncSend(void) {
+		return init_async_send(&u8g2);
+	}
+	void doneAsyncSend(void) {
+		done_async_send(&u8g2);
+	}
+	void sendBufferAsync(void) {
+		send_buffer_async(&u8g2);
+	}
+	void waitAsyncSend(void) {
+		wait_async_send(&u8g2);
+	}
 	void sleepMs(unsigned long milliseconds) {
 		sleep_ms(milliseconds);
 	}
@@ -7,6 +7,9 @@
  */
 
 #include "u8g2port.h"
+#include <string.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
 
 // c-periphery I2C handles
 static i2c_t *i2c_handles[MAX_I2C_HANDLES] = { NULL };
@@ -57,6 +60,11 @@ user_data_t* init_user_data(u8g2_t *u8g2) {
 	for (int i = 0; i < U8X8_PIN_CNT; ++i) {
 		user_data->pins[i] = NULL;
 	}
+	user_data->async_send = NULL;
+	user_data->i2c_batch = NULL;
+	user_data->index = 0;
+	user_data->spi_bufsiz = 0;
+	user_data->spi_dc = -1;
 	u8g2_SetUserPtr(u8g2, user_data);
 	return user_data;
 }
@@ -128,6 +136,9 @@ void init_spi_sw(u8g2_t *u8g2, uint8_t gpio_chip, uint8_t dc, uint8_t res,
 void done_user_data(u8g2_t *u8g2) {
 	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
 	if (user_data != NULL) {
+		// Stop the transfer thread
+		done_async_send(u8g2);
+		done_i2c_batch(u8g2);
 		// Close all GPIO pins
 		for (int i = 0; i < U8X8_PIN_CNT; ++i) {
 			if (user_data->pins[i] != NULL) {
@@ -143,6 +154,248 @@ void done_user_data(u8g2_t *u8g2) {
 	}
 }
 
+/*
+ * Monotonic time in nanoseconds.
+ */
+static unsigned long long get_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Transfer thread: Send the second buffer with the copy of the u8g2 object.
+ */
+static void* async_send_thread(void *arg) {
+	async_send_t *async_send = (async_send_t*) arg;
+	unsigned long long t;
+
+	pthread_mutex_lock(&async_send->mutex);
+	for (;;) {
+		while (!async_send->busy && !async_send->exit) {
+			pthread_cond_wait(&async_send->cond, &async_send->mutex);
+		}
+		// A pending frame is sent before the thread exits
+		if (!async_send->busy) {
+			break;
+		}
+		pthread_mutex_unlock(&async_send->mutex);
+		t = get_ns();
+		send_buffer_batch(&async_send->u8g2);
+		t = get_ns() - t;
+		pthread_mutex_lock(&async_send->mutex);
+		async_send->transfer_ns += t;
+		async_send->frames++;
+		async_send->busy = 0;
+		pthread_cond_broadcast(&async_send->cond);
+	}
+	pthread_mutex_unlock(&async_send->mutex);
+	return NULL;
+}
+
+/*
+ * Start the transfer thread for send_buffer_async(). Full buffer mode only.
+ * Must be called after init_i2c_hw(), init_spi_hw(), ... Returns 0 on success.
+ *
+ * While a frame is in transfer, the display must not be accessed with other
+ * u8g2/u8x8 procedures which use the bus (u8g2_SetPowerSave(),
+ * u8g2_SetContrast(), ...), call wait_async_send() before.
+ */
+int init_async_send(u8g2_t *u8g2) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+	async_send_t *async_send;
+
+	if (user_data->async_send != NULL) {
+		return 0;
+	}
+	async_send = (async_send_t*) malloc(sizeof(async_send_t));
+	if (async_send == NULL) {
+		return -1;
+	}
+	async_send->buf = (uint8_t*) malloc(u8g2_GetBufferSize(u8g2));
+	if (async_send->buf == NULL) {
+		free(async_send);
+		return -1;
+	}
+	async_send->busy = 0;
+	async_send->exit = 0;
+	async_send->frames = 0;
+	async_send->transfer_ns = 0;
+	async_send->wait_ns = 0;
+	pthread_mutex_init(&async_send->mutex, NULL);
+	pthread_cond_init(&async_send->cond, NULL);
+	int error = pthread_create(&async_send->thread, NULL, async_send_thread,
+			async_send);
+	if (error) {
+		fprintf(stderr, "pthread_create(): %d\n", error);
+		pthread_cond_destroy(&async_send->cond);
+		pthread_mutex_destroy(&async_send->mutex);
+		free(async_send->buf);
+		free(async_send);
+		return -1;
+	}
+	user_data->async_send = async_send;
+	return 0;
+}
+
+/*
+ * Send the pending frame and stop the transfer thread.
+ */
+void done_async_send(u8g2_t *u8g2) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+	async_send_t *async_send = user_data->async_send;
+
+	if (async_send != NULL) {
+		pthread_mutex_lock(&async_send->mutex);
+		async_send->exit = 1;
+		pthread_cond_broadcast(&async_send->cond);
+		pthread_mutex_unlock(&async_send->mutex);
+		pthread_join(async_send->thread, NULL);
+		pthread_cond_destroy(&async_send->cond);
+		pthread_mutex_destroy(&async_send->mutex);
+		free(async_send->buf);
+		free(async_send);
+		user_data->async_send = NULL;
+	}
+}
+
+/*
+ * Fence: Wait until the previous frame has been transferred.
+ */
+void wait_async_send(u8g2_t *u8g2) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+	async_send_t *async_send = user_data->async_send;
+	unsigned long long t;
+
+	if (async_send != NULL) {
+		t = get_ns();
+		pthread_mutex_lock(&async_send->mutex);
+		while (async_send->busy) {
+			pthread_cond_wait(&async_send->cond, &async_send->mutex);
+		}
+		async_send->wait_ns += get_ns() - t;
+		pthread_mutex_unlock(&async_send->mutex);
+#ifdef U8G2_WITH_SHADOW_BUFFER
+		// The transfer thread has updated the shadow buffer state in its copy
+		if (async_send->frames > 0) {
+			u8g2->is_shadow_valid = async_send->u8g2.is_shadow_valid;
+			u8g2->shadow_changed_tiles = async_send->u8g2.shadow_changed_tiles;
+			u8g2->shadow_frame_tiles = async_send->u8g2.shadow_frame_tiles;
+		}
+#endif
+	}
+}
+
+/*
+ * Replacement for u8g2_SendBuffer(): Copy the frame into the second buffer
+ * and return while the transfer thread sends it to the display. The
+ * application can draw the next frame immediately. Waits only if the
+ * previous frame is still in transfer. Same as u8g2_SendBuffer() if
+ * init_async_send() has not been called.
+ */
+void send_buffer_async(u8g2_t *u8g2) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+	async_send_t *async_send = user_data->async_send;
+
+	if (async_send == NULL) {
+		u8g2_SendBuffer(u8g2);
+		return;
+	}
+	wait_async_send(u8g2);
+	// The transfer thread is idle, the copy and the second buffer can be updated
+	async_send->u8g2 = *u8g2;
+	async_send->u8g2.tile_buf_ptr = async_send->buf;
+	memcpy(async_send->buf, u8g2_GetBufferPtr(u8g2), u8g2_GetBufferSize(u8g2));
+	pthread_mutex_lock(&async_send->mutex);
+	async_send->busy = 1;
+	pthread_cond_broadcast(&async_send->cond);
+	pthread_mutex_unlock(&async_send->mutex);
+}
+
+/*
+ * Enable send_buffer_batch() for I2C hardware. Must be called after
+ * init_i2c_hw(). Returns 0 on success.
+ */
+int init_i2c_batch(u8g2_t *u8g2) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+
+	if (user_data->i2c_batch != NULL) {
+		return 0;
+	}
+	user_data->i2c_batch = (i2c_batch_t*) malloc(sizeof(i2c_batch_t));
+	if (user_data->i2c_batch == NULL) {
+		return -1;
+	}
+	user_data->i2c_batch->active = 0;
+	user_data->i2c_batch->cnt = 0;
+	return 0;
+}
+
+/*
+ * Free the I2C transfer batch.
+ */
+void done_i2c_batch(u8g2_t *u8g2) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+
+	free(user_data->i2c_batch);
+	user_data->i2c_batch = NULL;
+}
+
+/*
+ * Send the collected I2C messages with one I2C_RDWR ioctl.
+ */
+static void flush_i2c_batch(user_data_t *user_data) {
+	i2c_batch_t *i2c_batch = user_data->i2c_batch;
+
+	if (i2c_batch->cnt > 0) {
+		i2c_transfer(i2c_handles[user_data->bus], i2c_batch->msgs,
+				i2c_batch->cnt);
+		i2c_batch->cnt = 0;
+	}
+}
+
+/*
+ * Replacement for u8g2_SendBuffer(): All command and data transfers of the
+ * frame are sent with one I2C_RDWR ioctl (or a few, the kernel accepts
+ * I2C_BATCH_MSGS messages per ioctl) instead of one ioctl per transfer.
+ * Same as u8g2_SendBuffer() if init_i2c_batch() has not been called.
+ */
+void send_buffer_batch(u8g2_t *u8g2) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+	i2c_batch_t *i2c_batch = user_data->i2c_batch;
+
+	if (i2c_batch == NULL) {
+		u8g2_SendBuffer(u8g2);
+		return;
+	}
+	i2c_batch->active = 1;
+	u8g2_SendBuffer(u8g2);
+	i2c_batch->active = 0;
+	flush_i2c_batch(user_data);
+}
+
+/*
+ * Number of transferred frames, total transfer time (the time the renderer
+ * would have stalled with u8g2_SendBuffer()) and the total time the renderer
+ * actually waited in send_buffer_async() and wait_async_send().
+ */
+void get_async_send_stats(u8g2_t *u8g2, unsigned long *frames,
+		unsigned long long *transfer_ns, unsigned long long *wait_ns) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+	async_send_t *async_send = user_data->async_send;
+
+	*frames = 0;
+	*transfer_ns = 0;
+	*wait_ns = 0;
+	if (async_send != NULL) {
+		pthread_mutex_lock(&async_send->mutex);
+		*frames = async_send->frames;
+		*transfer_ns = async_send->transfer_ns;
+		*wait_ns = async_send->wait_ns;
+		pthread_mutex_unlock(&async_send->mutex);
+	}
+}
+
 /**
  * Initialize pin if not set to U8X8_PIN_NONE and NULL.
  */
@@ -220,6 +473,35 @@ void done_i2c() {
 	}
 }
 
+/*
+ * Max bytes per SPI_IOC_MESSAGE, must not exceed the spidev bufsiz module
+ * parameter. By default the parameter is read by init_spi().
+ */
+void set_spi_bufsiz(u8g2_t *u8g2, uint32_t bufsiz) {
+	user_data_t *user_data = u8g2_GetUserPtr(u8g2);
+	// A segment or send of up to 255 bytes must fit into one message
+	if (bufsiz < 256) {
+		bufsiz = 256;
+	}
+	user_data->spi_bufsiz = bufsiz;
+}
+
+/*
+ * Read /sys/module/spidev/parameters/bufsiz, SPI_BUFSIZ if not available.
+ */
+static uint32_t get_spi_bufsiz(void) {
+	FILE *fp = fopen("/sys/module/spidev/parameters/bufsiz", "r");
+	unsigned long bufsiz = SPI_BUFSIZ;
+
+	if (fp != NULL) {
+		if (fscanf(fp, "%lu", &bufsiz) != 1 || bufsiz < 256) {
+			bufsiz = SPI_BUFSIZ;
+		}
+		fclose(fp);
+	}
+	return bufsiz;
+}
+
 /*
  * Initialize SPI bus.
  */
@@ -246,6 +528,9 @@ void init_spi(u8x8_t *u8x8) {
 			spi_handles[user_data->bus] = NULL;
 		}
 	}
+	if (user_data->spi_bufsiz == 0) {
+		user_data->spi_bufsiz = get_spi_bufsiz();
+	}
 }
 
 /*
@@ -410,6 +695,8 @@ uint8_t u8x8_byte_arm_linux_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
 	user_data_t *user_data;
 	uint8_t *data;
 	struct i2c_msg msgs[1];
+	i2c_batch_t *i2c_batch;
+	struct i2c_msg *batch_msg;
 
 	switch (msg) {
 	case U8X8_MSG_BYTE_SEND:
@@ -433,6 +720,20 @@ uint8_t u8x8_byte_arm_linux_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
 
 	case U8X8_MSG_BYTE_END_TRANSFER:
 		user_data = u8x8_GetUserPtr(u8x8);
+		i2c_batch = user_data->i2c_batch;
+		if (i2c_batch != NULL && i2c_batch->active) {
+			memcpy(i2c_batch->data[i2c_batch->cnt], user_data->buffer,
+					user_data->index);
+			batch_msg = &i2c_batch->msgs[i2c_batch->cnt];
+			batch_msg->addr = u8x8_GetI2CAddress(u8x8) >> 1;
+			batch_msg->flags = 0; // Write
+			batch_msg->len = user_data->index;
+			batch_msg->buf = i2c_batch->data[i2c_batch->cnt];
+			if (++i2c_batch->cnt == I2C_BATCH_MSGS) {
+				flush_i2c_batch(user_data);
+			}
+			break;
+		}
 		msgs[0].addr = u8x8_GetI2CAddress(u8x8) >> 1;
 		msgs[0].flags = 0; // Write
 		msgs[0].len = user_data->index;
@@ -446,40 +747,151 @@ uint8_t u8x8_byte_arm_linux_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
 	return 1;
 }
 
+/*
+ * Send the transfers with one SPI_IOC_MESSAGE ioctl, CS stays active.
+ */
+static void spi_message(user_data_t *user_data, struct spi_ioc_transfer *xfer,
+		unsigned int n) {
+	spi_t *spi = spi_handles[user_data->bus];
+
+	if (ioctl(spi_fd(spi), SPI_IOC_MESSAGE(n), xfer) < 0) {
+		perror("SPI_IOC_MESSAGE");
+	}
+}
+
+/*
+ * Send the collected bytes of the callback buffer followed by cnt bytes of
+ * data. The data is not copied, messages are limited to spi_bufsiz bytes.
+ */
+static void spi_send(user_data_t *user_data, const uint8_t *data, size_t cnt) {
+	struct spi_ioc_transfer xfer[2];
+	unsigned int n = 0;
+	size_t total = 0;
+	size_t len;
+
+	memset(xfer, 0, sizeof(xfer));
+	if (user_data->index > 0) {
+		xfer[0].tx_buf = (unsigned long) user_data->buffer;
+		xfer[0].len = user_data->index;
+		total = user_data->index;
+		user_data->index = 0;
+		n = 1;
+	}
+	do {
+		len = cnt;
+		if (len > user_data->spi_bufsiz - total) {
+			len = user_data->spi_bufsiz - total;
+		}
+		if (len > 0) {
+			xfer[n].tx_buf = (unsigned long) data;
+			xfer[n].len = len;
+			n++;
+			data += len;
+			cnt -= len;
+		}
+		if (n > 0) {
+			spi_message(user_data, xfer, n);
+		}
+		memset(xfer, 0, sizeof(xfer));
+		n = 0;
+		total = 0;
+	} while (cnt > 0);
+}
+
+/*
+ * Change the DC pin. Collected bytes are sent before, nothing happens if the
+ * level does not change.
+ */
+static void spi_set_dc(u8x8_t *u8x8, user_data_t *user_data, int dc) {
+	if (user_data->spi_dc != dc) {
+		spi_send(user_data, NULL, 0);
+		u8x8_gpio_SetDC(u8x8, dc);
+		user_data->spi_dc = dc;
+	}
+}
+
 /*
  * SPI callback.
+ *
+ * Consecutive sends with the same DC level are sent with one SPI_IOC_MESSAGE
+ * ioctl. Short sends (commands and args) are collected in the callback buffer
+ * until the DC level changes or the transfer ends, longer sends are
+ * transferred directly from the caller buffer together with the collected
+ * bytes.
  */
 uint8_t u8x8_byte_arm_linux_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
 		void *arg_ptr) {
 	user_data_t *user_data;
-	uint8_t *data;
+#ifdef U8X8_WITH_SEGMENTS
+	struct spi_ioc_transfer xfer[U8X8_SEGMENT_CNT];
+	u8x8_segment_t *seg;
+	unsigned int n;
+	size_t total;
+	uint8_t i;
+#endif
 
 	switch (msg) {
 	case U8X8_MSG_BYTE_SEND:
 		user_data = u8x8_GetUserPtr(u8x8);
-		user_data->index = 0;
-		data = (uint8_t*) arg_ptr;
-		while (arg_int > 0) {
-			user_data->buffer[user_data->index++] = *data;
-			data++;
-			arg_int--;
+		if (arg_int <= SPI_COPY_MAX) {
+			if (user_data->index + arg_int > sizeof(user_data->buffer)) {
+				spi_send(user_data, NULL, 0);
+			}
+			memcpy(user_data->buffer + user_data->index, arg_ptr, arg_int);
+			user_data->index += arg_int;
+		} else {
+			spi_send(user_data, (const uint8_t*) arg_ptr, arg_int);
 		}
-		spi_transfer(spi_handles[user_data->bus], user_data->buffer,
-				user_data->buffer, user_data->index);
 		break;
 
+#ifdef U8X8_WITH_SEGMENTS
+	case U8X8_MSG_BYTE_SEND_SEGMENTS:
+		// Segments are transferred directly from the tile buffer, one message
+		// for each run of segments with the same DC level
+		user_data = u8x8_GetUserPtr(u8x8);
+		seg = (u8x8_segment_t*) arg_ptr;
+		spi_send(user_data, NULL, 0);
+		memset(xfer, 0, sizeof(xfer));
+		n = 0;
+		total = 0;
+		for (i = 0; i < arg_int; i++) {
+			if (n > 0 && (seg[i].dc != user_data->spi_dc
+					|| total + seg[i].cnt > user_data->spi_bufsiz)) {
+				spi_message(user_data, xfer, n);
+				memset(xfer, 0, sizeof(xfer));
+				n = 0;
+				total = 0;
+			}
+			spi_set_dc(u8x8, user_data, seg[i].dc);
+			xfer[n].tx_buf = (unsigned long) seg[i].data;
+			xfer[n].len = seg[i].cnt;
+			total += seg[i].cnt;
+			n++;
+		}
+		if (n > 0) {
+			spi_message(user_data, xfer, n);
+		}
+		break;
+#endif
+
 	case U8X8_MSG_BYTE_INIT:
 		init_spi(u8x8);
+#ifdef U8X8_WITH_SEGMENTS
+		u8x8->is_byte_segments = 1;
+#endif
 		break;
 
 	case U8X8_MSG_BYTE_SET_DC:
-		u8x8_gpio_SetDC(u8x8, arg_int);
+		user_data = u8x8_GetUserPtr(u8x8);
+		spi_set_dc(u8x8, user_data, arg_int);
 		break;
 
 	case U8X8_MSG_BYTE_START_TRANSFER:
 		break;
 
 	case U8X8_MSG_BYTE_END_TRANSFER:
+		user_data = u8x8_GetUserPtr(u8x8);
+		spi_send(user_data, NULL, 0);
 		break;
 
 	default:
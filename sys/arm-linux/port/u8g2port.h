@@ -12,10 +12,61 @@ extern "C" {
 #include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 #define MAX_I2C_HANDLES 8
 #define MAX_SPI_HANDLES 256
 
+// SPI sends up to this size are copied and merged, longer sends are transferred from the caller buffer
+#define SPI_COPY_MAX 16
+// Default for the bytes per SPI_IOC_MESSAGE, the spidev bufsiz module parameter
+#define SPI_BUFSIZ 4096
+
+/*
+ * Double buffered asynchronous frame transfer, see init_async_send().
+ */
+struct async_send_struct {
+	// Transfer thread and synchronization
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	// Copy of the u8g2 object used by the transfer thread
+	u8g2_t u8g2;
+	// Second buffer, owned by the transfer thread
+	uint8_t *buf;
+	// A frame is waiting for or in transfer
+	int busy;
+	// Stop the transfer thread
+	int exit;
+	// Number of transferred frames
+	unsigned long frames;
+	// Total transfer time, the renderer would have stalled this long with u8g2_SendBuffer()
+	unsigned long long transfer_ns;
+	// Total time the renderer had to wait for the transfer thread
+	unsigned long long wait_ns;
+};
+
+typedef struct async_send_struct async_send_t;
+
+// Messages per I2C_RDWR ioctl, I2C_RDWR_IOCTL_MAX_MSGS of the kernel
+#define I2C_BATCH_MSGS 42
+
+/*
+ * I2C transfers collected for a single I2C_RDWR ioctl, see init_i2c_batch().
+ */
+struct i2c_batch_struct {
+	// Collect the transfers instead of sending them
+	int active;
+	// Number of collected messages
+	unsigned int cnt;
+	// One write message per START/END transfer
+	struct i2c_msg msgs[I2C_BATCH_MSGS];
+	// Message data, a copy of the callback buffer
+	uint8_t data[I2C_BATCH_MSGS][128];
+};
+
+typedef struct i2c_batch_struct i2c_batch_t;
+
 /*
  * User data passed in user_ptr of u8x8_struct.
  */
@@ -28,7 +79,7 @@ struct user_data_struct {
 	uint8_t bus;
 	// Index into buffer
 	uint8_t index;
-	// Callback buffer, I2C should send 32 bytes max and SPI 128 bytes max
+	// Callback buffer, I2C should send 32 bytes max, SPI collects bytes with the same DC level
 	uint8_t buffer[128];
 	// Nanosecond delay for U8X8_MSG_DELAY_I2C
 	unsigned long delay;
@@ -36,8 +87,16 @@ struct user_data_struct {
 	unsigned int spi_mode;
 	// SPI max speed
 	uint32_t max_speed;
+	// Max bytes per SPI_IOC_MESSAGE, 0: /sys/module/spidev/parameters/bufsiz
+	uint32_t spi_bufsiz;
+	// Current level of the DC pin, -1 if unknown
+	int spi_dc;
 	// Internal buffer
 	uint8_t *int_buf;
+	// NULL or asynchronous transfer
+	async_send_t *async_send;
+	// NULL or I2C transfer batching
+	i2c_batch_t *i2c_batch;
 };
 
 typedef struct user_data_struct user_data_t;
@@ -56,12 +115,22 @@ void init_spi_hw(u8g2_t *u8g2, uint8_t gpio_chip, uint8_t bus, uint8_t dc,
 void init_spi_sw(u8g2_t *u8g2, uint8_t gpio_chip, uint8_t dc, uint8_t res,
 		uint8_t mosi, uint8_t sck, uint8_t cs, unsigned long delay);
 void done_user_data(u8g2_t *u8g2);
+int init_async_send(u8g2_t *u8g2);
+void done_async_send(u8g2_t *u8g2);
+void send_buffer_async(u8g2_t *u8g2);
+void wait_async_send(u8g2_t *u8g2);
+void get_async_send_stats(u8g2_t *u8g2, unsigned long *frames,
+		unsigned long long *transfer_ns, unsigned long long *wait_ns);
+int init_i2c_batch(u8g2_t *u8g2);
+void done_i2c_batch(u8g2_t *u8g2);
+void send_buffer_batch(u8g2_t *u8g2);
 void init_pin(u8x8_t *u8x8, uint8_t pin);
 void write_pin(u8x8_t *u8x8, uint8_t pin, uint8_t value);
 void init_i2c(u8x8_t *u8x8);
 void done_i2c();
 void init_spi(u8x8_t *u8x8);
 void done_spi();
+void set_spi_bufsiz(u8g2_t *u8g2, uint32_t bufsiz);
 uint8_t u8x8_arm_linux_gpio_and_delay(u8x8_t *u8x8, uint8_t msg,
 		uint8_t arg_int, void *arg_ptr);
 uint8_t u8x8_byte_arm_linux_hw_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
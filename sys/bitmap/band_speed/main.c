@@ -0,0 +1,139 @@
+/*
+
+  band_speed
+
+  Compare the single threaded full buffer rendering with the band parallel 
+  renderer (../common/u8g2_band.c) on a 2040x512 bitmap device.
+  The same scene is drawn with 1, 2, 4, ... threads up to the number of
+  online processors. The result is compared against the single threaded
+  reference picture.
+  
+  Output is the time in milliseconds per frame (recording + replay for the 
+  band renderer) and the speedup against the single threaded reference.
+
+*/
+
+#include "u8g2.h"
+#include "u8g2_band.h"
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define WIDTH 2040
+#define HEIGHT 512
+#define LOOPS 20
+#define DLIST_SIZE 4000000
+
+u8g2_t u8g2;
+u8g2_band_t band;
+uint8_t dlist[DLIST_SIZE];
+
+static double get_ms(void)
+{
+  return bench_get_ns()*1.0E-6;
+}
+
+static unsigned rnd_state;
+static unsigned rnd(unsigned n)
+{
+  rnd_state = rnd_state*1103515245+12345;
+  return ((rnd_state>>16)&0x7fff) % n;
+}
+
+static void draw(void)
+{
+  u8g2_uint_t x, y;
+  int i;
+  rnd_state = 1;
+  u8g2_SetFontMode(&u8g2, 1);
+  for( i = 0; i < 2000; i++ )
+  {
+    u8g2_SetDrawColor(&u8g2, rnd(8) == 0 ? 2 : 1);
+    switch(rnd(6))
+    {
+      case 0: u8g2_DrawBox(&u8g2, rnd(WIDTH), rnd(HEIGHT), 1+rnd(200), 1+rnd(100)); break;
+      case 1: 
+        x = rnd(WIDTH); y = rnd(HEIGHT);
+        u8g2_DrawLine(&u8g2, x, y, x+rnd(200), y+rnd(200));
+        break;
+      case 2: u8g2_DrawDisc(&u8g2, rnd(WIDTH), rnd(HEIGHT), rnd(40), U8G2_DRAW_ALL); break;
+      case 3: u8g2_DrawCircle(&u8g2, rnd(WIDTH), rnd(HEIGHT), rnd(60), U8G2_DRAW_ALL); break;
+      case 4: 
+        u8g2_SetFont(&u8g2, u8g2_font_helvB08_tr);
+        u8g2_DrawStr(&u8g2, rnd(WIDTH), rnd(HEIGHT), "The quick brown fox jumps over the lazy dog");
+        break;
+      default: 
+        u8g2_SetFont(&u8g2, u8g2_font_ncenB14_tr);
+        u8g2_DrawStr(&u8g2, rnd(WIDTH), rnd(HEIGHT), "Hello World 0123456789");
+        break;
+    }
+  }
+  u8g2_SetDrawColor(&u8g2, 1);
+}
+
+int main(void)
+{
+  size_t buf_size;
+  uint8_t *ref;
+  unsigned thread_cnt, max_thread_cnt;
+  long nproc;
+  double t, t_ref;
+  int i, is_ok;
+
+  u8g2_SetupBitmap(&u8g2, U8G2_R0, WIDTH, HEIGHT);
+  buf_size = (size_t)u8g2_GetBufferTileWidth(&u8g2)*8*u8g2_GetBufferTileHeight(&u8g2);
+  ref = malloc(buf_size);
+  if ( ref == NULL )
+    return 1;
+  
+  nproc = sysconf(_SC_NPROCESSORS_ONLN);
+  max_thread_cnt = nproc < 1 ? 1 : (unsigned)nproc;
+  if ( max_thread_cnt > U8G2_BAND_MAX_THREADS )
+    max_thread_cnt = U8G2_BAND_MAX_THREADS;
+  
+  /* single threaded reference */
+  t = get_ms();
+  for( i = 0; i < LOOPS; i++ )
+  {
+    u8g2_ClearBuffer(&u8g2);
+    draw();
+  }
+  t_ref = (get_ms() - t) / LOOPS;
+  memcpy(ref, u8g2_GetBufferPtr(&u8g2), buf_size);
+  printf("%dx%d reference:      %8.2f ms\n", WIDTH, HEIGHT, t_ref);
+  
+  for( thread_cnt = 1; thread_cnt <= max_thread_cnt; thread_cnt *= 2 )
+  {
+    if ( u8g2_band_Init(&band, &u8g2, thread_cnt, 0) == 0 )
+    {
+      printf("threads=%2u: thread creation failed\n", thread_cnt);
+      break;
+    }
+    is_ok = 1;
+    t = get_ms();
+    for( i = 0; i < LOOPS; i++ )
+    {
+      u8g2_ClearBuffer(&u8g2);
+      u8g2_band_Begin(&band, dlist, DLIST_SIZE);
+      draw();
+      if ( u8g2_band_End(&band) == 0 )
+      {
+        is_ok = 0;
+        break;
+      }
+    }
+    t = (get_ms() - t) / LOOPS;
+    if ( is_ok == 0 )
+      printf("threads=%2u: display list too small, %lu bytes required\n", thread_cnt, (unsigned long)u8g2_GetDisplayListUsage(&u8g2));
+    else
+      printf("threads=%2u bands=%3u: %8.2f ms  speedup %5.2f  %s\n", thread_cnt, band.band_cnt, t, t_ref/t, 
+        memcmp(ref, u8g2_GetBufferPtr(&u8g2), buf_size) == 0 ? "ok" : "MISMATCH");
+    u8g2_band_Destroy(&band);
+    if ( thread_cnt < max_thread_cnt && thread_cnt*2 > max_thread_cnt )
+      thread_cnt = max_thread_cnt/2;	/* always measure max_thread_cnt */
+  }
+  free(ref);
+  return 0;
+}
@@ -0,0 +1,81 @@
+/*
+
+  box_speed
+
+  Measure the time for u8g2_DrawBox for typical box sizes 
+  (inverted menu row, progress bar, full screen) and all draw colors:
+    vertical_top_lsb:		SSD1306 128x64 buffer
+    horizontal_right_lsb:	SH1122 256x64 buffer
+    
+  The result is compared with drawing the same box with u8g2_DrawHLine for 
+  each row (this was the u8g2_DrawBox implementation without ll_box).
+  Output is the time in nanoseconds per call.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 20000UL
+
+u8g2_t u8g2;
+
+static double measure(u8g2_uint_t w, u8g2_uint_t h, uint8_t color, uint8_t is_hline)
+{
+  unsigned long i;
+  u8g2_uint_t x, y, j;
+  double t;
+
+  u8g2_SetDrawColor(&u8g2, color);
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+  {
+    /* vary the start position, so that all bit positions are used */
+    x = i & 7;
+    y = (i >> 3) & 7;
+    if ( is_hline )
+    {
+      for( j = 0; j < h; j++ )
+        u8g2_DrawHLine(&u8g2, x, y+j, w);
+    }
+    else
+    {
+      u8g2_DrawBox(&u8g2, x, y, w, h);
+    }
+  }
+  t = bench_get_ns() - t;
+  return t / (double)LOOPS;
+}
+
+static void measure_all(const char *name)
+{
+  static const u8g2_uint_t size_list[][2] = { { 120, 10 }, { 100, 6 }, { 8, 8 }, { 20, 40 }, { 120, 56 } };
+  uint8_t color;
+  unsigned i;
+
+  for( i = 0; i < sizeof(size_list)/sizeof(*size_list); i++ )
+  {
+    printf("%-22s %3dx%-3d", name, size_list[i][0], size_list[i][1]);
+    for( color = 0; color < 3; color++ )
+      printf("  c%d: %7.1f / %7.1f ns", color, 
+        measure(size_list[i][0], size_list[i][1], color, 0), 
+        measure(size_list[i][0], size_list[i][1], color, 1));
+    printf("\n");
+  }
+}
+
+int main(void)
+{
+  printf("DrawBox / DrawHLine for each row\n");
+  
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  measure_all("vertical_top_lsb");
+
+  u8g2_Setup_sh1122_256x64_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  measure_all("horizontal_right_lsb");
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+/*
+
+  bench.c
+  
+  Common procedures for the *_speed benchmarks in sys/bitmap.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+
+double bench_get_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec*1.0E9 + (double)ts.tv_nsec;
+}
+
+/*
+  Reference results: The classic build of a benchmark is started with
+  "-w <file>" and writes each measured value into the file. The other 
+  build is started with "<file>" and reads the values in the same order, 
+  so that it can print the ratio. Without an argument, bench_ref() 
+  does nothing.
+*/
+
+static FILE *bench_ref_fp = NULL;
+static int bench_ref_is_write = 0;
+
+/* returns 0 if the file can not be opened */
+int bench_ref_init(int argc, char **argv)
+{
+  if ( argc >= 3 && strcmp(argv[1], "-w") == 0 )
+  {
+    bench_ref_is_write = 1;
+    bench_ref_fp = fopen(argv[2], "w");
+  }
+  else if ( argc >= 2 )
+  {
+    bench_ref_is_write = 0;
+    bench_ref_fp = fopen(argv[1], "r");
+  }
+  else
+  {
+    return 1;
+  }
+  if ( bench_ref_fp == NULL )
+  {
+    perror(argv[argc-1]);
+    return 0;
+  }
+  return 1;
+}
+
+/* 
+  Write the measured value or read the corresponding reference value. 
+  Returns the reference value or 0.0 if there is none.
+*/
+double bench_ref(double value)
+{
+  double ref;
+  if ( bench_ref_fp == NULL )
+    return 0.0;
+  if ( bench_ref_is_write != 0 )
+  {
+    fprintf(bench_ref_fp, "%.6g\n", value);
+    return 0.0;
+  }
+  if ( fscanf(bench_ref_fp, "%lf", &ref) != 1 )
+    return 0.0;
+  return ref;
+}
+
+void bench_ref_done(void)
+{
+  if ( bench_ref_fp != NULL )
+    fclose(bench_ref_fp);
+  bench_ref_fp = NULL;
+}
@@ -0,0 +1,21 @@
+/*
+
+  bench.h
+  
+  Common procedures for the *_speed benchmarks in sys/bitmap.
+  See bench.c and bench.mk
+
+*/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/* monotonic clock in nanoseconds */
+double bench_get_ns(void);
+
+/* reference results of another build, see bench.c */
+int bench_ref_init(int argc, char **argv);
+double bench_ref(double value);
+void bench_ref_done(void);
+
+#endif
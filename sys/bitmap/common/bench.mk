@@ -0,0 +1,30 @@
+#
+# bench.mk
+#
+# Common makefile for the *_speed benchmarks in sys/bitmap. Set the
+# following variables and include this file before any other target:
+#   BENCH		name of the benchmark executable
+#   BENCH_CFLAGS	additional flags, e.g. -DU8G2_WITH_... for opt-in features
+#   BENCH_SRC		additional source files (optional)
+#   BENCH_CLEAN	additional files for "make clean" (optional)
+# The objects are placed into the obj directory of the benchmark, so that 
+# benchmarks with different BENCH_CFLAGS do not share the objects of csrc.
+#
+
+CFLAGS = -O2 -Wall -I../../../csrc/. -I../common/. $(BENCH_CFLAGS)
+
+SRC = $(shell ls ../../../csrc/*.c) ../common/bench.c $(BENCH_SRC) main.c
+
+OBJ = $(addprefix obj/,$(notdir $(SRC:.c=.o)))
+
+vpath %.c ../../../csrc ../common
+
+$(BENCH): $(OBJ)
+	$(CC) $(CFLAGS) $(LDFLAGS) $(OBJ) -o $@
+
+obj/%.o: %.c
+	@mkdir -p obj
+	$(CC) $(CFLAGS) -c $< -o $@
+
+clean:
+	-rm -rf obj $(BENCH) $(BENCH_CLEAN)
@@ -0,0 +1,250 @@
+/*
+
+  u8g2_band.c
+  
+  Band parallel renderer for the full buffer mode on Linux hosts (pthreads).
+  
+  The draw procedures are recorded into a display list (see csrc/u8g2_dlist.c).
+  The buffer (tile_buf_ptr) is split into bands of tile rows. Each worker thread
+  has its own copy of the u8g2 object, which is configured like the page mode:
+  tile_buf_ptr points to the band and the page window (together with the clip window) 
+  restricts drawing to the band. The display list is then replayed for each band.
+  Each band is written by exactly one thread and the display list is only read
+  during the replay, so no locks are required. Bands are assigned round robin to the
+  threads (band b is drawn by thread b % thread_cnt).
+  
+    u8g2_band_t band;
+    static uint8_t dlist[65536];
+    
+    u8g2_SetupBitmap(&u8g2, U8G2_R0, 2040, 512);
+    u8g2_band_Init(&band, &u8g2, 4, 0);
+    
+    u8g2_ClearBuffer(&u8g2);
+    u8g2_band_Begin(&band, dlist, sizeof(dlist));
+    draw();
+    if ( u8g2_band_End(&band) == 0 )
+    {
+      // display list too small, draw again without the band renderer
+      draw();
+    }
+    u8g2_SendBuffer(&u8g2);
+    
+    u8g2_band_Destroy(&band);
+
+  Limitations: see csrc/u8g2_dlist.c
+
+*/
+
+#include <string.h>
+#include "u8g2_band.h"
+
+/*========================================================*/
+
+/* draw all bands of one worker */
+static void u8g2_band_render(u8g2_band_worker_t *w)
+{
+  u8g2_band_t *band = w->band;
+  u8g2_t *u8g2 = &(w->u8g2);
+  uint8_t tile_height = u8g2_GetU8x8(band->u8g2)->display_info->tile_height;
+  size_t row_size = (size_t)u8g2_GetBufferTileWidth(band->u8g2)*8;
+  unsigned b;
+  uint8_t row;
+  
+  *u8g2 = *(band->u8g2);
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2->dirty_tile_buf = NULL;		/* the dirty tiles are marked by u8g2_band_End() */
+#endif
+  /* the caches are modified during lookup, but the memory is shared by all workers: disable them */
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+  u8g2->font_glyph_index = NULL;
+  u8g2->font_glyph_index_font = NULL;
+#endif
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+  u8g2->font_glyph_cache = NULL;
+  u8g2->font_glyph_cache_mask = 0;
+#endif
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+  u8g2->str_width_cache = NULL;
+  u8g2->str_width_cache_mask = 0;
+#endif
+#ifdef U8G2_WITH_KERNING_CACHE
+  u8g2->kerning_cache = NULL;
+  u8g2->kerning_cache_mask = 0;
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+  u8g2->font_bitmap_cache = NULL;
+  u8g2->font_bitmap_cache_cnt = 0;
+#endif
+  for( b = w->idx; b < band->band_cnt; b += band->thread_cnt )
+  {
+    row = b * band->band_tile_height;
+    u8g2->tile_buf_ptr = band->u8g2->tile_buf_ptr + row*row_size;
+    u8g2->tile_buf_height = band->band_tile_height;
+    if ( row + u8g2->tile_buf_height > tile_height )
+      u8g2->tile_buf_height = tile_height - row;
+    u8g2_SetBufferCurrTileRow(u8g2, row);
+    u8g2_dlist_replay(u8g2);
+  }
+}
+
+static void *u8g2_band_thread(void *arg)
+{
+  u8g2_band_worker_t *w = (u8g2_band_worker_t *)arg;
+  
+  uint8_t is_started;
+  
+  /* wait until u8g2_band_Init() has created all threads (or has failed) */
+  pthread_mutex_lock(&(w->band->init_mutex));
+  is_started = w->band->is_started;
+  pthread_mutex_unlock(&(w->band->init_mutex));
+  if ( is_started == 0 )
+    return NULL;
+  
+  for(;;)
+  {
+    pthread_barrier_wait(&(w->band->start_barrier));
+    if ( w->band->is_exit )
+      break;
+    u8g2_band_render(w);
+    pthread_barrier_wait(&(w->band->done_barrier));
+  }
+  return NULL;
+}
+
+/*========================================================*/
+
+/*
+  Create thread_cnt-1 worker threads, the calling thread is used as the first worker.
+  band_tile_height is the number of tile rows per band. If 0, the height is selected 
+  so that there is one band for each thread: Each band has to scan the complete 
+  display list, so more bands only help if the scene is very unbalanced.
+  Returns 0 if the threads could not be created.
+*/
+int u8g2_band_Init(u8g2_band_t *band, u8g2_t *u8g2, unsigned thread_cnt, uint8_t band_tile_height)
+{
+  uint8_t tile_height = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+  unsigned i;
+  
+  if ( thread_cnt < 1 )
+    thread_cnt = 1;
+  if ( thread_cnt > U8G2_BAND_MAX_THREADS )
+    thread_cnt = U8G2_BAND_MAX_THREADS;
+  if ( band_tile_height == 0 )
+  {
+    band_tile_height = (tile_height + thread_cnt - 1) / thread_cnt;
+    if ( band_tile_height == 0 )
+      band_tile_height = 1;
+  }
+  
+  band->u8g2 = u8g2;
+  band->thread_cnt = thread_cnt;
+  band->band_tile_height = band_tile_height;
+  band->band_cnt = (tile_height + band_tile_height - 1) / band_tile_height;
+  band->is_exit = 0;
+  band->is_started = 0;
+  
+  if ( pthread_mutex_init(&(band->init_mutex), NULL) != 0 )
+    return 0;
+  if ( pthread_barrier_init(&(band->start_barrier), NULL, thread_cnt) != 0 )
+  {
+    pthread_mutex_destroy(&(band->init_mutex));
+    return 0;
+  }
+  if ( pthread_barrier_init(&(band->done_barrier), NULL, thread_cnt) != 0 )
+  {
+    pthread_barrier_destroy(&(band->start_barrier));
+    pthread_mutex_destroy(&(band->init_mutex));
+    return 0;
+  }
+  
+  for( i = 0; i < thread_cnt; i++ )
+  {
+    band->worker[i].band = band;
+    band->worker[i].idx = i;
+  }
+  
+  /* 
+    The barriers expect thread_cnt threads, so the workers must not use them before 
+    all threads exist: The workers wait for init_mutex, which is locked until then.
+  */
+  pthread_mutex_lock(&(band->init_mutex));
+  for( i = 1; i < thread_cnt; i++ )
+  {
+    if ( pthread_create(&(band->worker[i].thread), NULL, u8g2_band_thread, band->worker+i) != 0 )
+    {
+      /* stop and join the threads, which have been created */
+      pthread_mutex_unlock(&(band->init_mutex));
+      while( i > 1 )
+      {
+        i--;
+        pthread_join(band->worker[i].thread, NULL);
+      }
+      pthread_barrier_destroy(&(band->start_barrier));
+      pthread_barrier_destroy(&(band->done_barrier));
+      pthread_mutex_destroy(&(band->init_mutex));
+      return 0;
+    }
+  }
+  band->is_started = 1;
+  pthread_mutex_unlock(&(band->init_mutex));
+  return 1;
+}
+
+void u8g2_band_Destroy(u8g2_band_t *band)
+{
+  unsigned i;
+  band->is_exit = 1;
+  if ( band->thread_cnt > 1 )
+  {
+    pthread_barrier_wait(&(band->start_barrier));
+    for( i = 1; i < band->thread_cnt; i++ )
+      pthread_join(band->worker[i].thread, NULL);
+  }
+  pthread_barrier_destroy(&(band->start_barrier));
+  pthread_barrier_destroy(&(band->done_barrier));
+  pthread_mutex_destroy(&(band->init_mutex));
+}
+
+/*
+  Start recording of the draw procedures into dlist_buf. 
+  The u8g2 object must not be used for other purposes until u8g2_band_End() is called.
+*/
+void u8g2_band_Begin(u8g2_band_t *band, uint8_t *dlist_buf, size_t dlist_size)
+{
+  u8g2_SetDisplayList(band->u8g2, dlist_buf, dlist_size);
+  u8g2_SetBufferCurrTileRow(band->u8g2, 0);
+  u8g2_dlist_start(band->u8g2);
+}
+
+/*
+  Stop recording and draw the display list into the buffer with all threads.
+  Returns 0 if the display list was too small. Nothing has been drawn in this case,
+  u8g2_GetDisplayListUsage() returns the required size.
+*/
+int u8g2_band_End(u8g2_band_t *band)
+{
+  u8g2_t *u8g2 = band->u8g2;
+  int result = 0;
+  
+  if ( u8g2_GetDisplayListUsage(u8g2) <= u8g2->dlist_size )
+  {
+    u8g2->dlist_state = U8G2_DLIST_STATE_REPLAY;
+    if ( band->thread_cnt > 1 )
+      pthread_barrier_wait(&(band->start_barrier));
+    u8g2_band_render(band->worker);
+    if ( band->thread_cnt > 1 )
+      pthread_barrier_wait(&(band->done_barrier));
+    result = 1;
+  }
+  
+  /* disable the display list, but keep dlist_pos for u8g2_GetDisplayListUsage() */
+  u8g2->dlist_state = U8G2_DLIST_STATE_OFF;
+  u8g2->dlist_buf = NULL;
+  u8g2->dlist_size = 0;
+  u8g2_SetBufferCurrTileRow(u8g2, 0);	/* restore the page window */
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( result != 0 && u8g2->dirty_tile_buf != NULL )
+    u8g2_MarkDirtyArea(u8g2, 0, 0, u8g2->pixel_buf_width, u8g2->pixel_buf_height);
+#endif
+  return result;
+}
@@ -0,0 +1,52 @@
+/*
+
+  u8g2_band.h
+  
+  Band parallel renderer for the full buffer mode on Linux hosts (pthreads).
+  See u8g2_band.c
+
+*/
+
+#ifndef U8G2_BAND_H
+#define U8G2_BAND_H
+
+#include <pthread.h>
+#include "u8g2.h"
+
+#ifndef U8G2_WITH_DISPLAY_LIST
+#error "The band renderer requires the display list, define U8G2_WITH_DISPLAY_LIST"
+#endif
+
+#define U8G2_BAND_MAX_THREADS 64
+
+typedef struct _u8g2_band_t u8g2_band_t;
+typedef struct _u8g2_band_worker_t u8g2_band_worker_t;
+
+struct _u8g2_band_worker_t
+{
+  u8g2_band_t *band;
+  pthread_t thread;
+  unsigned idx;			/* 0 is the calling thread */
+  u8g2_t u8g2;			/* private copy of the u8g2 object, tile_buf_ptr points to one band of the buffer */
+};
+
+struct _u8g2_band_t
+{
+  u8g2_t *u8g2;			/* the u8g2 object in full buffer mode */
+  unsigned thread_cnt;
+  unsigned band_cnt;
+  uint8_t band_tile_height;	/* number of tile rows per band */
+  volatile uint8_t is_exit;
+  pthread_mutex_t init_mutex;	/* locked by u8g2_band_Init() until all threads are created */
+  uint8_t is_started;		/* all threads have been created, protected by init_mutex */
+  pthread_barrier_t start_barrier;
+  pthread_barrier_t done_barrier;
+  u8g2_band_worker_t worker[U8G2_BAND_MAX_THREADS];
+};
+
+int u8g2_band_Init(u8g2_band_t *band, u8g2_t *u8g2, unsigned thread_cnt, uint8_t band_tile_height);
+void u8g2_band_Destroy(u8g2_band_t *band);
+void u8g2_band_Begin(u8g2_band_t *band, uint8_t *dlist_buf, size_t dlist_size);
+int u8g2_band_End(u8g2_band_t *band);
+
+#endif /* U8G2_BAND_H */
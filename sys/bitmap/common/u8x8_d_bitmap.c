@@ -274,8 +274,15 @@ void u8g2_SetupBitmap(u8g2_t *u8g2, const u8g2_cb_t *u8g2_cb, uint16_t pixel_wid
 
 static uint8_t u8x8_d_bitmap_chain(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
+  uint16_t ty;
   if ( msg == U8X8_MSG_DISPLAY_DRAW_TILE )
     u8x8_d_bitmap(u8x8, msg, arg_int, arg_ptr);
+  if ( msg == U8X8_MSG_DISPLAY_DRAW_FULL_FRAME )
+  {
+    /* if the display does not support this, the frame is captured again with DRAW_TILE */
+    for( ty = 0; ty < u8x8_bitmap.tile_height; ty++ )
+      u8x8_DrawBitmapTiles(u8x8, 0, ty, u8x8_bitmap.tile_width, (uint8_t *)arg_ptr + (size_t)ty*u8x8_bitmap.tile_width*8);
+  }
   return u8x8_bitmap.u8x8_bitmap_display_old_cb(u8x8, msg, arg_int, arg_ptr);
 }
 
@@ -0,0 +1,697 @@
+/*
+
+  feature_test
+
+  Draw the same random scenes with several display controllers, rotations
+  and buffer modes and print a hash of the buffer and of the bytes sent to
+  the display. "make test" builds this program
+  three times:
+    feature_test_off	all optional features and speed optimizations disabled
+    feature_test		default configuration
+    feature_test_on	all optional features enabled
+  and compares the output, which must be identical.
+
+  The data bytes (dc=1) are compared for all displays. The command bytes
+  are compared only if the full frame upload is not used: With the full
+  frame upload, the SSD1306 receives the same data with other commands.
+
+  Features, which send only a part of the frame, are also checked with the
+  bitmap capture device (../common/u8x8_d_bitmap.c): The captured display
+  content must be the same as after sending the complete frame. Differences
+  are printed (so that the output comparison fails) and the exit code is 1.
+  The full frame upload is checked with a model of the SSD1306 display RAM.
+
+*/
+
+#include "u8g2.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SEED_CNT 12
+
+u8g2_t u8g2;
+
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+uint16_t glyph_index[U8G2_FONT_GLYPH_INDEX_CNT];
+#endif
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+u8g2_font_glyph_cache_t glyph_cache[8];
+#endif
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+u8g2_str_width_cache_t str_width_cache[4];
+#endif
+#ifdef U8G2_WITH_KERNING_CACHE
+u8g2_kerning_cache_t kerning_cache[4];
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+u8g2_font_bitmap_t font_bitmap_cache[4];
+#endif
+#ifdef U8G2_WITH_DISPLAY_LIST
+uint8_t dlist[4000];
+#endif
+#ifdef U8G2_WITH_DIRTY_TILES
+uint8_t dirty_tile_buf[256];
+#endif
+#ifdef U8G2_WITH_SHADOW_BUFFER
+uint8_t shadow_buf[256*64/8];
+#endif
+
+/*========================================================*/
+/* bus */
+
+static unsigned long data_hash;
+static unsigned long data_cnt;
+static unsigned long cmd_hash;
+static unsigned long cmd_cnt;
+static uint8_t dc;
+
+#ifdef U8G2_WITH_FULL_FRAME_UPLOAD
+static void ssd1306_ram_write(uint8_t dc, uint8_t b);
+#endif
+
+static void bus_reset(void)
+{
+  data_hash = 5381;
+  data_cnt = 0;
+  cmd_hash = 5381;
+  cmd_cnt = 0;
+}
+
+static uint8_t u8x8_byte_hash(U8X8_UNUSED u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  uint8_t *p = (uint8_t *)arg_ptr;
+  switch(msg)
+  {
+    case U8X8_MSG_BYTE_SEND:
+      while( arg_int > 0 )
+      {
+#ifdef U8G2_WITH_FULL_FRAME_UPLOAD
+	ssd1306_ram_write(dc, *p);
+#endif
+	if ( dc != 0 )
+	{
+	  data_hash = data_hash*33 + *p;
+	  data_cnt++;
+	}
+	else
+	{
+	  cmd_hash = cmd_hash*33 + *p;
+	  cmd_cnt++;
+	}
+	p++;
+	arg_int--;
+      }
+      break;
+    case U8X8_MSG_BYTE_SET_DC:
+      dc = arg_int;
+      break;
+    case U8X8_MSG_BYTE_START_TRANSFER:
+      cmd_hash = cmd_hash*33 + 0x100;
+      break;
+    case U8X8_MSG_BYTE_END_TRANSFER:
+      cmd_hash = cmd_hash*33 + 0x200;
+      break;
+    default:
+      break;
+  }
+  return 1;
+}
+
+static void print_bus(uint8_t is_full_frame)
+{
+  printf(" data=%08lx/%lu", data_hash & 0xffffffffUL, data_cnt);
+  if ( is_full_frame == 0 )
+    printf(" cmd=%08lx/%lu", cmd_hash & 0xffffffffUL, cmd_cnt);
+}
+
+static void print_buffer(void)
+{
+  unsigned long h = 5381;
+  size_t i, n = (size_t)u8g2_GetBufferTileWidth(&u8g2)*8*u8g2_GetBufferTileHeight(&u8g2);
+  uint8_t *p = u8g2_GetBufferPtr(&u8g2);
+  for( i = 0; i < n; i++ )
+    h = h*33 + p[i];
+  printf(" buf=%08lx", h & 0xffffffffUL);
+}
+
+/*========================================================*/
+/* scene */
+
+static unsigned rnd_state;
+static unsigned rnd(unsigned n)
+{
+  rnd_state = rnd_state*1103515245+12345;
+  return ((rnd_state>>16)&0x7fff) % n;
+}
+
+static const uint8_t xbm[] = { 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81, 0xff, 0x00, 0xaa, 0x55 };
+
+static void draw_scene(unsigned seed)
+{
+  static const uint8_t *font_list[] = { u8g2_font_helvB08_tr, u8g2_font_ncenB14_tr, u8g2_font_6x10_tf, u8g2_font_inb33_mn, u8g2_font_unifont_t_chinese2 };
+  int w = u8g2_GetDisplayWidth(&u8g2);
+  int h = u8g2_GetDisplayHeight(&u8g2);
+  int i;
+
+  rnd_state = seed;
+  for( i = 0; i < 40; i++ )
+  {
+    u8g2_SetDrawColor(&u8g2, rnd(3));
+    switch(rnd(12))
+    {
+      case 0: u8g2_DrawBox(&u8g2, rnd(w+20)-10, rnd(h+20)-10, rnd(w), rnd(h)); break;
+      case 1: u8g2_DrawHLine(&u8g2, rnd(w+20)-10, rnd(h), rnd(w+30)); break;
+      case 2: u8g2_DrawVLine(&u8g2, rnd(w), rnd(h+20)-10, rnd(h+30)); break;
+      case 3: u8g2_DrawLine(&u8g2, rnd(w), rnd(h), rnd(w), rnd(h)); break;
+      case 4: u8g2_DrawDisc(&u8g2, rnd(w), rnd(h), rnd(20), U8G2_DRAW_ALL); break;
+      case 5: u8g2_DrawRFrame(&u8g2, rnd(w), rnd(h), 8+rnd(w), 8+rnd(h), 3); break;
+      case 6:
+	u8g2_SetFont(&u8g2, font_list[rnd(5)]);
+	u8g2_SetFontMode(&u8g2, rnd(2));
+	u8g2_SetFontDirection(&u8g2, rnd(4));
+	u8g2_DrawStr(&u8g2, rnd(w), rnd(h), "Hello Wg 0123");
+	break;
+      case 7:
+	u8g2_SetFont(&u8g2, u8g2_font_unifont_t_chinese2);
+	u8g2_SetFontMode(&u8g2, rnd(2));
+	u8g2_SetFontDirection(&u8g2, 0);
+	u8g2_DrawUTF8(&u8g2, rnd(w), rnd(h), "\xe4\xbd\xa0\xe5\xa5\xbd\xe4\xb8\x96\xe7\x95\x8c Ab");
+	break;
+      case 8:
+	u8g2_SetBitmapMode(&u8g2, rnd(2));
+	u8g2_DrawXBM(&u8g2, rnd(w)-4, rnd(h)-4, 8, 12, xbm);
+	break;
+      case 9:
+	u8g2_SetFont(&u8g2, font_list[rnd(5)]);
+	u8g2_SetFontMode(&u8g2, rnd(2));
+	u8g2_SetFontDirection(&u8g2, 0);
+	u8g2_DrawStrScaled(&u8g2, rnd(w), rnd(h), 1+rnd(4), "X2 y7");
+	break;
+      case 10: u8g2_DrawRBox(&u8g2, rnd(w), rnd(h), 10+rnd(40), 10+rnd(30), 3); break;
+      case 11: u8g2_DrawPixel(&u8g2, rnd(w), rnd(h)); break;
+    }
+  }
+  u8g2_SetDrawColor(&u8g2, 1);
+  u8g2_SetFontDirection(&u8g2, 0);
+}
+
+/*========================================================*/
+/* setup */
+
+typedef void (*setup_fn)(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x8_msg_cb byte_cb, u8x8_msg_cb gpio_and_delay_cb);
+
+struct display_struct
+{
+  const char *name;
+  setup_fn setup;
+  uint8_t is_full_frame;	/* 1: full buffer, which is sent with the full frame upload, the commands are not compared */
+};
+
+static const struct display_struct display_list[] =
+{
+  { "ssd1306_128x64_noname_f", u8g2_Setup_ssd1306_128x64_noname_f, 1 },
+  { "ssd1306_128x64_vcomh0_f", u8g2_Setup_ssd1306_128x64_vcomh0_f, 1 },
+  { "ssd1312_128x32_f", u8g2_Setup_ssd1312_128x32_f, 0 },
+  { "ssd1312_128x64_noname_f", u8g2_Setup_ssd1312_128x64_noname_f, 0 },
+  { "ssd1320_160x80_f", u8g2_Setup_ssd1320_160x80_f, 0 },
+  { "sh1106_128x64_noname_f", u8g2_Setup_sh1106_128x64_noname_f, 0 },
+  { "st7920_s_128x64_f", u8g2_Setup_st7920_s_128x64_f, 0 },
+  { "sh1122_256x64_f", u8g2_Setup_sh1122_256x64_f, 0 },
+  { "ssd1306_128x64_noname_1", u8g2_Setup_ssd1306_128x64_noname_1, 0 },
+  { "ssd1306_128x64_noname_2", u8g2_Setup_ssd1306_128x64_noname_2, 0 },
+  { "st7920_s_128x64_1", u8g2_Setup_st7920_s_128x64_1, 0 },
+};
+
+static const u8g2_cb_t *rotation_list[] = { U8G2_R0, U8G2_R1, U8G2_R2, U8G2_MIRROR };
+
+#define DISPLAY_CNT (sizeof(display_list)/sizeof(*display_list))
+#define ROTATION_CNT (sizeof(rotation_list)/sizeof(*rotation_list))
+
+/* setup the display without any of the optional features */
+static void setup_plain(const struct display_struct *display, const u8g2_cb_t *rotation)
+{
+  display->setup(&u8g2, rotation, u8x8_byte_hash, u8x8_dummy_cb);
+  u8g2_InitDisplay(&u8g2);
+}
+
+static void setup(const struct display_struct *display, const u8g2_cb_t *rotation, unsigned seed)
+{
+  setup_plain(display, rotation);
+#ifdef U8G2_WITH_FONT_GLYPH_INDEX
+  u8g2_SetFontGlyphIndex(&u8g2, glyph_index);
+#endif
+#ifdef U8G2_WITH_FONT_GLYPH_CACHE
+  u8g2_SetFontGlyphCache(&u8g2, glyph_cache, sizeof(glyph_cache)/sizeof(*glyph_cache));
+#endif
+#ifdef U8G2_WITH_STR_WIDTH_CACHE
+  u8g2_SetStrWidthCache(&u8g2, str_width_cache, sizeof(str_width_cache)/sizeof(*str_width_cache));
+#endif
+#ifdef U8G2_WITH_KERNING_CACHE
+  u8g2_SetKerningCache(&u8g2, kerning_cache, sizeof(kerning_cache)/sizeof(*kerning_cache));
+#endif
+#ifdef U8G2_WITH_FONT_BITMAP_CACHE
+  u8g2_SetFontBitmapCache(&u8g2, font_bitmap_cache, sizeof(font_bitmap_cache)/sizeof(*font_bitmap_cache));
+#endif
+#ifdef U8G2_WITH_DISPLAY_LIST
+  u8g2_SetDisplayList(&u8g2, dlist, sizeof(dlist));
+#endif
+#ifdef U8G2_WITH_DIRTY_TILES
+  if ( u8g2_GetDirtyTileBufferSize(&u8g2) <= sizeof(dirty_tile_buf) )
+    u8g2_SetDirtyTileBuffer(&u8g2, dirty_tile_buf);
+#endif
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  /* the count mode sends all tiles, odd seeds only, so that the full frame upload is also used */
+  if ( (seed & 1) != 0 && u8g2_GetBufferBitsPerPixel(&u8g2) == 1 && u8g2_GetShadowBufferSize(&u8g2) <= sizeof(shadow_buf) )
+    u8g2_SetShadowBuffer(&u8g2, shadow_buf, U8G2_SHADOW_MODE_COUNT);
+#endif
+  (void)seed;
+}
+
+static void send_buffer(unsigned seed)
+{
+#ifdef U8G2_WITH_INCREMENTAL_SEND
+  if ( (seed % 3) == 0 )
+  {
+    /* one tile row per step, this sends the same bytes as u8g2_SendBuffer() */
+    u8g2_SendBufferBegin(&u8g2);
+    while( u8g2_SendBufferStep(&u8g2, u8g2_GetBufferTileWidth(&u8g2)) != 0 )
+      ;
+    u8g2_SendBufferDone(&u8g2);
+    return;
+  }
+#endif
+  u8g2_SendBuffer(&u8g2);
+  (void)seed;
+}
+
+/*========================================================*/
+/* tests */
+
+static void test_display(const struct display_struct *display)
+{
+  unsigned r, seed;
+
+  for( r = 0; r < ROTATION_CNT; r++ )
+    for( seed = 1; seed <= SEED_CNT; seed++ )
+    {
+      setup(display, rotation_list[r], seed);
+      printf("%-24s r%u s%-2u", display->name, r, seed);
+      bus_reset();
+      if ( u8g2_GetBufferTileHeight(&u8g2) == u8g2_GetU8x8(&u8g2)->display_info->tile_height )
+      {
+#ifdef U8G2_WITH_FULL_FRAME_UPLOAD
+	if ( u8g2_GetU8x8(&u8g2)->is_full_frame != display->is_full_frame )
+	  printf(" unexpected is_full_frame");
+#endif
+	u8g2_ClearBuffer(&u8g2);
+	draw_scene(seed);
+	print_buffer();
+	send_buffer(seed);
+      }
+      else
+      {
+	u8g2_FirstPage(&u8g2);
+	do
+	{
+	  draw_scene(seed);
+	} while( u8g2_NextPage(&u8g2) );
+      }
+      print_bus(display->is_full_frame);
+      printf("\n");
+    }
+}
+
+/* strings with the same length and the same characters must not share a cache entry */
+static void test_str_width(void)
+{
+  static const char *str_list[] = { "Ab", "BA", "AB", "bA", "Ab", "W", "i", "WWW", "iii", "Hello World", "dlroW olleH", "BA", "Ab" };
+  unsigned i;
+
+  setup(display_list, U8G2_R0, 0);
+  u8g2_SetFont(&u8g2, u8g2_font_helvB08_tr);
+  printf("str width");
+  for( i = 0; i < sizeof(str_list)/sizeof(*str_list); i++ )
+    printf(" %s=%d", str_list[i], (int)u8g2_GetStrWidth(&u8g2, str_list[i]));
+  u8g2_SetFont(&u8g2, u8g2_font_ncenB14_tr);
+  for( i = 0; i < sizeof(str_list)/sizeof(*str_list); i++ )
+    printf(" %s=%d", str_list[i], (int)u8g2_GetStrWidth(&u8g2, str_list[i]));
+  printf("\n");
+}
+
+/* the first table is not sorted (older bdfconv versions), the second one is sorted */
+static const uint16_t kerning_first_unsorted[] = { 0x56, 0x41, 0x54, 0xffff };
+static const uint16_t kerning_index_unsorted[] = { 0, 2, 4, 5 };
+static const uint16_t kerning_second_unsorted[] = { 0x6f, 0x41, 0x56, 0x2e, 0x61 };
+static const uint16_t kerning_first_sorted[] = { 0x41, 0x54, 0x56, 0xffff };
+static const uint16_t kerning_index_sorted[] = { 0, 2, 3, 5 };
+static const uint16_t kerning_second_sorted[] = { 0x2e, 0x56, 0x61, 0x41, 0x6f };
+static const uint8_t kerning_values_unsorted[] = { 1, 2, 3, 4, 5 };
+static const uint8_t kerning_values_sorted[] = { 4, 3, 5, 2, 1 };
+static u8g2_kerning_t kerning_unsorted = { 4, 5, kerning_first_unsorted, kerning_index_unsorted, kerning_second_unsorted, kerning_values_unsorted };
+static u8g2_kerning_t kerning_sorted = { 4, 5, kerning_first_sorted, kerning_index_sorted, kerning_second_sorted, kerning_values_sorted, 1 };
+
+static void test_kerning(void)
+{
+  static const char str[] = "VoVATA.TaTAVxAVo";
+  unsigned i;
+
+  setup(display_list, U8G2_R0, 0);
+  printf("kerning");
+  for( i = 0; i+1 < sizeof(str)-1; i++ )
+    printf(" %c%c=%u/%u", str[i], str[i+1],
+      u8g2_GetKerning(&u8g2, &kerning_unsorted, str[i], str[i+1]),
+      u8g2_GetKerning(&u8g2, &kerning_sorted, str[i], str[i+1]));
+  printf("\n");
+}
+
+/*========================================================*/
+/* capture comparison */
+
+static unsigned capture_error_cnt;
+
+#if defined(U8G2_WITH_DIRTY_TILES) || defined(U8G2_WITH_SHADOW_BUFFER) || defined(U8G2_WITH_DISPLAY_LIST)
+static uint8_t capture_full[256*80];
+static uint8_t capture_part[256*80];
+
+/* connect the bitmap capture device, must be called after the setup */
+static void capture_connect(void)
+{
+  u8x8_ConnectBitmapToU8x8(u8g2_GetU8x8(&u8g2));
+}
+
+static void capture_get(uint8_t *dest)
+{
+  u8x8_t *u8x8 = u8g2_GetU8x8(&u8g2);
+  uint16_t x, y, w = u8x8_GetCols(u8x8)*8, h = u8x8_GetRows(u8x8)*8;
+  for( y = 0; y < h; y++ )
+    for( x = 0; x < w; x++ )
+      *dest++ = u8x8_GetBitmapPixel(u8x8, x, y);
+}
+
+/* compare capture_part with capture_full, print the first difference */
+static void capture_compare(const char *test, const struct display_struct *display, unsigned r, unsigned seed)
+{
+  u8x8_t *u8x8 = u8g2_GetU8x8(&u8g2);
+  uint16_t w = u8x8_GetCols(u8x8)*8;
+  size_t i, n = (size_t)w*u8x8_GetRows(u8x8)*8;
+  for( i = 0; i < n; i++ )
+  {
+    if ( capture_part[i] != capture_full[i] )
+    {
+      printf("%s: %s r%u s%u differs at x=%u y=%u\n", test, display->name, r, seed, (unsigned)(i % w), (unsigned)(i / w));
+      capture_error_cnt++;
+      return;
+    }
+  }
+}
+#endif
+
+#ifdef U8G2_WITH_DIRTY_TILES
+/*
+  u8g2_SendDirtyTiles() after drawing on top of the previous frame
+  must give the same display content as u8g2_SendBuffer()
+*/
+static unsigned test_dirty_tiles(const struct display_struct *display)
+{
+  unsigned r, seed, cnt = 0;
+  for( r = 0; r < ROTATION_CNT; r++ )
+    for( seed = 1; seed <= SEED_CNT; seed++ )
+    {
+      setup_plain(display, rotation_list[r]);
+      if ( u8g2_GetBufferTileHeight(&u8g2) != u8g2_GetU8x8(&u8g2)->display_info->tile_height )
+	return cnt;	/* full buffer only */
+      if ( u8g2_GetDirtyTileBufferSize(&u8g2) > sizeof(dirty_tile_buf) )
+	return cnt;
+      capture_connect();
+      u8g2_SetDirtyTileBuffer(&u8g2, dirty_tile_buf);
+      u8g2_ClearBuffer(&u8g2);
+      draw_scene(seed);
+      u8g2_SendDirtyTiles(&u8g2);		/* all tiles are dirty after u8g2_SetDirtyTileBuffer() */
+      draw_scene(seed+1000);
+      if ( (seed & 1) == 0 )
+	u8g2_DrawBox(&u8g2, seed*3, seed*2, 9, 5);
+      u8g2_SendDirtyTiles(&u8g2);
+      capture_get(capture_part);
+      u8g2_SendBuffer(&u8g2);
+      capture_get(capture_full);
+      capture_compare("dirty tiles", display, r, seed);
+      cnt++;
+    }
+  return cnt;
+}
+#endif
+
+#ifdef U8G2_WITH_SHADOW_BUFFER
+/*
+  in diff mode, only the changed tiles are sent: the display content
+  must be the same as after sending all tiles without the shadow buffer
+*/
+/* invert a small area, so that at least one tile is changed */
+static void shadow_draw_change(unsigned seed)
+{
+  u8g2_SetDrawColor(&u8g2, 2);
+  u8g2_DrawBox(&u8g2, (seed*13) % (u8g2_GetDisplayWidth(&u8g2)-8), (seed*7) % (u8g2_GetDisplayHeight(&u8g2)-8), 5, 5);
+  u8g2_SetDrawColor(&u8g2, 1);
+}
+
+static void shadow_draw_frame(unsigned seed, uint8_t is_changed)
+{
+  if ( u8g2_GetBufferTileHeight(&u8g2) == u8g2_GetU8x8(&u8g2)->display_info->tile_height )
+  {
+    u8g2_ClearBuffer(&u8g2);
+    draw_scene(seed);
+    if ( is_changed )
+      shadow_draw_change(seed);
+    u8g2_SendBuffer(&u8g2);
+  }
+  else
+  {
+    u8g2_FirstPage(&u8g2);
+    do
+    {
+      draw_scene(seed);
+      if ( is_changed )
+	shadow_draw_change(seed);
+    } while( u8g2_NextPage(&u8g2) );
+  }
+}
+
+static unsigned test_shadow_diff(const struct display_struct *display)
+{
+  unsigned r, seed, cnt = 0;
+  for( r = 0; r < ROTATION_CNT; r++ )
+    for( seed = 1; seed <= SEED_CNT; seed++ )
+    {
+      setup_plain(display, rotation_list[r]);
+      if ( u8g2_GetBufferBitsPerPixel(&u8g2) != 1 || u8g2_GetShadowBufferSize(&u8g2) > sizeof(shadow_buf) )
+	return cnt;
+      capture_connect();
+      u8g2_SetShadowBuffer(&u8g2, shadow_buf, U8G2_SHADOW_MODE_DIFF);
+      shadow_draw_frame(seed, 0);		/* the first frame is sent completely */
+      shadow_draw_frame(seed, 1);
+      if ( u8g2_GetChangedTiles(&u8g2) == 0 || u8g2_GetChangedTiles(&u8g2) >= u8g2_GetFrameTiles(&u8g2) )
+      {
+	printf("shadow diff: %s r%u s%u %u of %u tiles changed\n", display->name, r, seed,
+	  (unsigned)u8g2_GetChangedTiles(&u8g2), (unsigned)u8g2_GetFrameTiles(&u8g2));
+	capture_error_cnt++;
+      }
+      capture_get(capture_part);
+      u8g2_SetShadowBuffer(&u8g2, NULL, U8G2_SHADOW_MODE_DIFF);
+      shadow_draw_frame(seed, 1);
+      capture_get(capture_full);
+      capture_compare("shadow diff", display, r, seed);
+      cnt++;
+    }
+  return cnt;
+}
+#endif
+
+#ifdef U8G2_WITH_DISPLAY_LIST
+static unsigned dlist_loop_cnt;
+
+static void dlist_draw_pages(unsigned seed)
+{
+  dlist_loop_cnt = 0;
+  u8g2_FirstPage(&u8g2);
+  do
+  {
+    draw_scene(seed);
+    dlist_loop_cnt++;
+  } while( u8g2_NextPage(&u8g2) );
+}
+
+/*
+  the replay of the display list must give the same display content as
+  the picture loop without display list. If the display list is too small,
+  the picture loop is executed again for each page (u8g2_dlist_next_page()).
+*/
+static unsigned test_dlist(const struct display_struct *display)
+{
+  static uint8_t small_dlist[16];
+  unsigned r, seed, cnt = 0;
+  uint8_t pages;
+  for( r = 0; r < ROTATION_CNT; r++ )
+    for( seed = 1; seed <= SEED_CNT; seed++ )
+    {
+      setup_plain(display, rotation_list[r]);
+      pages = (u8g2_GetU8x8(&u8g2)->display_info->tile_height + u8g2_GetBufferTileHeight(&u8g2) - 1) / u8g2_GetBufferTileHeight(&u8g2);
+      if ( pages == 1 )
+	return cnt;	/* page buffer only */
+      capture_connect();
+      dlist_draw_pages(seed);
+      capture_get(capture_full);
+
+      u8g2_SetDisplayList(&u8g2, dlist, sizeof(dlist));
+      dlist_draw_pages(seed);
+      if ( u8g2_GetDisplayListUsage(&u8g2) <= sizeof(dlist) && dlist_loop_cnt != 1 )
+      {
+	printf("dlist: %s r%u s%u picture loop executed %u times\n", display->name, r, seed, dlist_loop_cnt);
+	capture_error_cnt++;
+      }
+      capture_get(capture_part);
+      capture_compare("dlist", display, r, seed);
+
+      u8g2_SetDisplayList(&u8g2, small_dlist, sizeof(small_dlist));
+      dlist_draw_pages(seed);
+      if ( u8g2_GetDisplayListUsage(&u8g2) <= sizeof(small_dlist) || dlist_loop_cnt != pages+1 )
+      {
+	printf("dlist overflow: %s r%u s%u picture loop executed %u times\n", display->name, r, seed, dlist_loop_cnt);
+	capture_error_cnt++;
+      }
+      capture_get(capture_part);
+      capture_compare("dlist overflow", display, r, seed);
+      cnt++;
+    }
+  return cnt;
+}
+#endif
+
+#ifdef U8G2_WITH_FULL_FRAME_UPLOAD
+/*
+  SSD1306 display RAM in horizontal addressing mode, only the commands
+  used by the DRAW_TILE and DRAW_FULL_FRAME messages are interpreted
+*/
+static uint8_t ssd1306_ram[8][128];
+static uint8_t ssd1306_col, ssd1306_page;
+static uint8_t ssd1306_window[4];	/* first column, last column, first page, last page */
+static uint8_t ssd1306_cmd, ssd1306_arg_cnt;
+
+/* state after the init sequence, called after u8g2_InitDisplay() */
+static void ssd1306_ram_reset(void)
+{
+  memset(ssd1306_ram, 0, sizeof(ssd1306_ram));
+  ssd1306_col = 0;
+  ssd1306_page = 0;
+  ssd1306_window[0] = 0;
+  ssd1306_window[1] = 127;
+  ssd1306_window[2] = 0;
+  ssd1306_window[3] = 7;
+  ssd1306_arg_cnt = 0;
+}
+
+static void ssd1306_ram_write(uint8_t dc, uint8_t b)
+{
+  if ( dc != 0 )
+  {
+    ssd1306_ram[ssd1306_page&7][ssd1306_col&127] = b;
+    if ( ssd1306_col >= ssd1306_window[1] )
+    {
+      ssd1306_col = ssd1306_window[0];
+      ssd1306_page = ssd1306_page >= ssd1306_window[3] ? ssd1306_window[2] : ssd1306_page+1;
+    }
+    else
+    {
+      ssd1306_col++;
+    }
+  }
+  else if ( ssd1306_arg_cnt > 0 )
+  {
+    /* arguments of 0x21 (column window) and 0x22 (page window) */
+    ssd1306_window[(ssd1306_cmd-0x21)*2 + 2 - ssd1306_arg_cnt] = b;
+    ssd1306_arg_cnt--;
+    ssd1306_col = ssd1306_window[0];
+    ssd1306_page = ssd1306_window[2];
+  }
+  else if ( b < 0x10 )
+    ssd1306_col = (ssd1306_col & 0xf0) | b;
+  else if ( b < 0x20 )
+    ssd1306_col = (ssd1306_col & 0x0f) | ((b & 15) << 4);
+  else if ( b == 0x21 || b == 0x22 )
+  {
+    ssd1306_cmd = b;
+    ssd1306_arg_cnt = 2;
+  }
+  else if ( (b & 0xf8) == 0xb0 )
+    ssd1306_page = b & 7;
+}
+
+/*
+  the display RAM after the full frame upload and a following partial
+  update must be the same as after sending the tiles
+*/
+static unsigned test_full_frame(const struct display_struct *display)
+{
+  static uint8_t ram[8][128];
+  unsigned r, seed, cnt = 0;
+  uint8_t is_full_frame;
+  if ( display->is_full_frame == 0 )
+    return cnt;
+  for( r = 0; r < ROTATION_CNT; r++ )
+    for( seed = 1; seed <= SEED_CNT; seed++ )
+    {
+      for( is_full_frame = 0; is_full_frame < 2; is_full_frame++ )
+      {
+	setup_plain(display, rotation_list[r]);
+	u8g2_GetU8x8(&u8g2)->is_full_frame = is_full_frame;
+	ssd1306_ram_reset();
+	u8g2_ClearBuffer(&u8g2);
+	draw_scene(seed);
+	u8g2_SendBuffer(&u8g2);
+	draw_scene(seed+1000);
+	u8g2_UpdateDisplayArea(&u8g2, seed % 8, seed % 4, 1 + seed % 5, 1 + seed % 3);
+	if ( is_full_frame == 0 )
+	  memcpy(ram, ssd1306_ram, sizeof(ram));
+      }
+      if ( memcmp(ram, ssd1306_ram, sizeof(ram)) != 0 )
+      {
+	printf("full frame: %s r%u s%u display RAM differs\n", display->name, r, seed);
+	capture_error_cnt++;
+      }
+      cnt++;
+    }
+  return cnt;
+}
+#endif
+
+int main(void)
+{
+  unsigned i, cnt;
+  for( i = 0; i < DISPLAY_CNT; i++ )
+    test_display(display_list+i);
+  test_str_width();
+  test_kerning();
+
+  /* the result of the capture comparison is written to stderr, it is not part of the compared output */
+#ifdef U8G2_WITH_DIRTY_TILES
+  for( i = 0, cnt = 0; i < DISPLAY_CNT; i++ )
+    cnt += test_dirty_tiles(display_list+i);
+  fprintf(stderr, "dirty tiles: %u frames compared\n", cnt);
+#endif
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  for( i = 0, cnt = 0; i < DISPLAY_CNT; i++ )
+    cnt += test_shadow_diff(display_list+i);
+  fprintf(stderr, "shadow diff: %u frames compared\n", cnt);
+#endif
+#ifdef U8G2_WITH_DISPLAY_LIST
+  for( i = 0, cnt = 0; i < DISPLAY_CNT; i++ )
+    cnt += test_dlist(display_list+i);
+  fprintf(stderr, "dlist: %u frames compared\n", cnt);
+#endif
+#ifdef U8G2_WITH_FULL_FRAME_UPLOAD
+  for( i = 0, cnt = 0; i < DISPLAY_CNT; i++ )
+    cnt += test_full_frame(display_list+i);
+  fprintf(stderr, "full frame: %u frames compared\n", cnt);
+#endif
+  (void)cnt;
+  return capture_error_cnt != 0;
+}
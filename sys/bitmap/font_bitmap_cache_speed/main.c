@@ -0,0 +1,78 @@
+/*
+
+  font_bitmap_cache_speed
+
+  Draw a text screen (6 lines) with and without the bitmap cache for 
+  decoded glyphs (u8g2_SetFontBitmapCache) in transparent and solid 
+  font mode:
+    vertical_top_lsb:		SSD1306 128x64 buffer, bitmap copy (ll_bitmap)
+    horizontal_right_lsb:	ST7920 128x64 buffer, lines from the bitmap
+  Output is the time in microseconds per screen.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 2000UL
+
+u8g2_t u8g2;
+u8g2_font_bitmap_t font_bitmap_cache[64];
+
+static const char *lines[] = 
+{
+  "Temperature: 23.5 C",
+  "Humidity:    45 %",
+  "Pressure:  1013 hPa",
+  "Battery:     87 %",
+  "Signal:     -67 dBm",
+  "Uptime: 12:34:56",
+};
+
+static double measure(void)
+{
+  unsigned long i;
+  uint8_t j;
+  double t;
+  
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+  {
+    u8g2_ClearBuffer(&u8g2);
+    for( j = 0; j < sizeof(lines)/sizeof(*lines); j++ )
+      u8g2_DrawStr(&u8g2, 0, 10+j*10, lines[j]);
+  }
+  t = bench_get_ns() - t;
+  return t / (double)LOOPS / 1000.0;
+}
+
+static void measure_all(const char *name)
+{
+  uint8_t mode;
+  double t0, t1;
+  
+  u8g2_SetFont(&u8g2, u8g2_font_6x10_tf);
+  for( mode = 0; mode < 2; mode++ )
+  {
+    u8g2_SetFontMode(&u8g2, mode);
+    u8g2_SetFontBitmapCache(&u8g2, NULL, 0);
+    t0 = measure();
+    u8g2_SetFontBitmapCache(&u8g2, font_bitmap_cache, sizeof(font_bitmap_cache)/sizeof(*font_bitmap_cache));
+    t1 = measure();
+    printf("%-22s %-11s without cache: %7.1f us  with cache: %7.1f us\n", name, mode ? "transparent" : "solid", t0, t1);
+  }
+}
+
+int main(void)
+{
+  printf("bitmap cache RAM: %u bytes\n", (unsigned)sizeof(font_bitmap_cache));
+  
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  measure_all("vertical_top_lsb");
+  
+  u8g2_Setup_st7920_s_128x64_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  measure_all("horizontal_right_lsb");
+  
+  return 0;
+}
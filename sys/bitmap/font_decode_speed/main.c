@@ -0,0 +1,99 @@
+/*
+
+  font_decode_speed
+
+  Draw all glyphs of some fonts into a SSD1306 full buffer and
+  report the number of glyphs per second. The second column uses a bitmap
+  cache with one entry: Each glyph is decoded into the cache bitmap, which 
+  is then copied into the buffer. This mainly measures the decoder. Glyphs 
+  which do not fit into the cache bitmap are decoded as usual.
+  "make test" compares the run length decoder with and without
+  the bit reservoir (U8G2_WITHOUT_FONT_BIT_RESERVOIR): The classic build
+  writes its results into a file, the default build reads this file and
+  reports the speedup (see bench.c).
+  More fonts from tools/font/build (u8g2_fonts.c) can be added to font_list.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define MIN_NS 200.0E6
+
+u8g2_t u8g2;
+u8g2_font_bitmap_t font_bitmap_cache[1];
+
+struct font_struct
+{
+  const char *name;
+  const uint8_t *font;
+};
+
+static const struct font_struct font_list[] = 
+{
+  { "6x10_tf", u8g2_font_6x10_tf },
+  { "helvB08_tr", u8g2_font_helvB08_tr },
+  { "ncenB14_tr", u8g2_font_ncenB14_tr },
+  { "inb33_mn", u8g2_font_inb33_mn },
+  { "unifont_t_chinese2", u8g2_font_unifont_t_chinese2 },
+};
+
+static uint16_t encoding_list[0x10000];
+
+static double measure(const uint8_t *font)
+{
+  unsigned long cnt, glyphs;
+  unsigned long i;
+  double t, start;
+  
+  u8g2_SetFont(&u8g2, font);
+  cnt = 0;
+  for( i = 0; i < 0x10000; i++ )
+    if ( u8g2_IsGlyph(&u8g2, i) )
+      encoding_list[cnt++] = i;
+  
+  glyphs = 0;
+  start = bench_get_ns();
+  do
+  {
+    for( i = 0; i < cnt; i++ )
+      u8g2_DrawGlyph(&u8g2, (i & 7)*12, 50, encoding_list[i]);
+    glyphs += cnt;
+    t = bench_get_ns() - start;
+  } while( t < MIN_NS );
+  return (double)glyphs * 1.0E9 / t;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned i;
+  double draw, copy, draw_ref, copy_ref;
+  
+  if ( bench_ref_init(argc, argv) == 0 )
+    return 1;
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SetDrawColor(&u8g2, 2);
+#ifdef U8G2_WITH_FONT_BIT_RESERVOIR
+  printf("bit reservoir decoder\n");
+#else
+  printf("classic decoder\n");
+#endif
+  printf("%-22s %16s %16s\n", "", "draw", "decode+copy");
+  for( i = 0; i < sizeof(font_list)/sizeof(*font_list); i++ )
+  {
+    u8g2_SetFontBitmapCache(&u8g2, NULL, 0);
+    draw = measure(font_list[i].font);
+    u8g2_SetFontBitmapCache(&u8g2, font_bitmap_cache, 1);
+    copy = measure(font_list[i].font);
+    draw_ref = bench_ref(draw);
+    copy_ref = bench_ref(copy);
+    printf("%-22s %10.0f glyphs/s %10.0f glyphs/s", font_list[i].name, draw, copy);
+    if ( draw_ref > 0.0 && copy_ref > 0.0 )
+      printf("  speedup %5.2f %5.2f", draw/draw_ref, copy/copy_ref);
+    printf("\n");
+  }
+  bench_ref_done();
+  return 0;
+}
@@ -0,0 +1,78 @@
+/*
+
+  font_dir_speed
+
+  Draw a string in all four directions (u8g2_SetFontDirection) into a 
+  SSD1306 full buffer in transparent and solid mode and report the time 
+  per glyph.
+  "make test" compares the direction specific run length draw procedures
+  with u8g2_font_decode_len() (U8G2_WITHOUT_FONT_DIR_DECODE) and reports
+  the speedup against the results of the classic build (see bench.c).
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 20000UL
+
+u8g2_t u8g2;
+
+static const char str[] = "42%";
+#define GLYPH_CNT 3
+
+/* start position for each direction, so that the string is fully visible */
+static const u8g2_uint_t pos[4][2] = { { 10, 40 }, { 40, 5 }, { 118, 24 }, { 88, 60 } };
+
+/* best of 5 runs */
+static double measure(uint8_t dir, uint8_t is_transparent)
+{
+  unsigned long i;
+  unsigned run;
+  double t, best = 1.0E30;
+  
+  u8g2_SetFontDirection(&u8g2, dir);
+  u8g2_SetFontMode(&u8g2, is_transparent);
+  for( run = 0; run < 5; run++ )
+  {
+    t = bench_get_ns();
+    for( i = 0; i < LOOPS; i++ )
+      u8g2_DrawStr(&u8g2, pos[dir][0], pos[dir][1], str);
+    t = bench_get_ns() - t;
+    if ( best > t )
+      best = t;
+  }
+  return best / (double)LOOPS / (double)GLYPH_CNT;
+}
+
+int main(int argc, char **argv)
+{
+  uint8_t dir;
+  double transparent, solid, transparent_ref, solid_ref;
+  
+  if ( bench_ref_init(argc, argv) == 0 )
+    return 1;
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SetFont(&u8g2, u8g2_font_ncenB14_tr);
+  u8g2_SetDrawColor(&u8g2, 2);
+#ifdef U8G2_WITH_FONT_DIR_DECODE
+  printf("direction specific decoder\n");
+#else
+  printf("u8g2_font_decode_len\n");
+#endif
+  for( dir = 0; dir < 4; dir++ )
+  {
+    transparent = measure(dir, 1);
+    solid = measure(dir, 0);
+    transparent_ref = bench_ref(transparent);
+    solid_ref = bench_ref(solid);
+    printf("dir=%d  transparent: %7.1f ns/glyph  solid: %7.1f ns/glyph", dir, transparent, solid);
+    if ( transparent_ref > 0.0 && solid_ref > 0.0 )
+      printf("  speedup %5.2f %5.2f", transparent_ref/transparent, solid_ref/solid);
+    printf("\n");
+  }
+  bench_ref_done();
+  return 0;
+}
@@ -0,0 +1,61 @@
+/*
+
+  font_offset_table_speed
+
+  Measure u8g2_GetUTF8Width for the same font without glyph offset
+  table and with a dense or sparse offset table (bdfconv option -i).
+  The fonts are created by the Makefile with bdfconv from t0-13-uni.bdf.
+  The width calculation mainly consists of the glyph lookup.
+  Output is the time in nanoseconds per glyph.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#include "font_none.c"
+#include "font_dense.c"
+#include "font_sparse.c"
+
+#define LOOPS 20000UL
+
+u8g2_t u8g2;
+
+/* "The quick brown fox" */
+static const char ascii_str[] = "The quick brown fox";
+#define ASCII_GLYPH_CNT 19
+
+/* "Цифровой календарь" and some katakana */
+static const char unicode_str[] = "\xd0\xa6\xd0\xb8\xd1\x84\xd1\x80\xd0\xbe\xd0\xb2\xd0\xbe\xd0\xb9 \xd0\xba\xd0\xb0\xd0\xbb\xd0\xb5\xd0\xbd\xd0\xb4\xd0\xb0\xd1\x80\xd1\x8c \xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88";
+#define UNICODE_GLYPH_CNT 22
+
+static double measure_width(const char *str, unsigned glyph_cnt)
+{
+  unsigned long i;
+  volatile u8g2_uint_t w;
+  double t;
+  
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+    w = u8g2_GetUTF8Width(&u8g2, str);
+  t = bench_get_ns() - t;
+  (void)w;
+  return t / (double)LOOPS / (double)glyph_cnt;
+}
+
+static void measure(const char *name, const uint8_t *font)
+{
+  u8g2_SetFont(&u8g2, font);
+  printf("%-8s size %5u bytes  ascii: %6.1f ns  unicode: %6.1f ns\n", name, (unsigned)u8g2_GetFontSize(font),
+    measure_width(ascii_str, ASCII_GLYPH_CNT), measure_width(unicode_str, UNICODE_GLYPH_CNT));
+}
+
+int main(void)
+{
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  measure("none", font_none);
+  measure("dense", font_dense);
+  measure("sparse", font_sparse);
+  return 0;
+}
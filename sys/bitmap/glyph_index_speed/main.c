@@ -0,0 +1,74 @@
+/*
+
+  glyph_index_speed
+
+  Measure u8g2_GetStrWidth and u8g2_DrawStr with and without the 
+  glyph index (u8g2_SetFontGlyphIndex) for some fonts.
+  Glyphs at the end of a font benefit most, because without the index
+  the glyph data is searched from the start of the font (or from 'A'/'a').
+  Output is the time in nanoseconds per call.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 20000UL
+
+u8g2_t u8g2;
+uint16_t glyph_index[U8G2_FONT_GLYPH_INDEX_CNT];
+
+static const char str[] = "Hello World! 0123456789 xyz";
+
+static double measure_width(void)
+{
+  unsigned long i;
+  volatile u8g2_uint_t w;
+  double t;
+  
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+    w = u8g2_GetStrWidth(&u8g2, str);
+  t = bench_get_ns() - t;
+  (void)w;
+  return t / (double)LOOPS;
+}
+
+static double measure_draw(void)
+{
+  unsigned long i;
+  double t;
+  
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+    u8g2_DrawStr(&u8g2, 0, 30, str);
+  t = bench_get_ns() - t;
+  return t / (double)LOOPS;
+}
+
+static void measure_font(const char *name, const uint8_t *font)
+{
+  double w0, w1, d0, d1;
+  
+  u8g2_SetFontGlyphIndex(&u8g2, NULL);
+  u8g2_SetFont(&u8g2, font);
+  w0 = measure_width();
+  d0 = measure_draw();
+  u8g2_SetFontGlyphIndex(&u8g2, glyph_index);
+  w1 = measure_width();
+  d1 = measure_draw();
+  printf("%-22s width: %8.1f -> %8.1f ns  draw: %8.1f -> %8.1f ns\n", name, w0, w1, d0, d1);
+}
+
+int main(void)
+{
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  printf("glyph index RAM: %u bytes\n", (unsigned)sizeof(glyph_index));
+  measure_font("helvB08_tr", u8g2_font_helvB08_tr);
+  measure_font("ncenB14_tr", u8g2_font_ncenB14_tr);
+  measure_font("6x10_tf", u8g2_font_6x10_tf);
+  measure_font("unifont_t_chinese2", u8g2_font_unifont_t_chinese2);
+  return 0;
+}
@@ -0,0 +1,73 @@
+/*
+
+  hvline_speed
+
+  Measure the time for u8g2_DrawHVLine for different line lengths,
+  draw colors and both buffer layouts:
+    vertical_top_lsb:		SSD1306 128x64 buffer
+    horizontal_right_lsb:	SH1122 256x64 buffer
+
+  The u8g2_DrawHVLine overhead (clipping, rotation) is included.
+  Output is the time in nanoseconds per call.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 200000UL
+
+u8g2_t u8g2;
+
+static double measure(uint8_t dir, u8g2_uint_t len, uint8_t color)
+{
+  unsigned long i;
+  u8g2_uint_t x, y;
+  double t;
+
+  u8g2_SetDrawColor(&u8g2, color);
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+  {
+    /* vary the start position, so that all bit positions are used */
+    x = i & 7;
+    y = (i >> 3) & 7;
+    u8g2_DrawHVLine(&u8g2, x, y, len, dir);
+  }
+  t = bench_get_ns() - t;
+  return t / (double)LOOPS;
+}
+
+static void measure_all(const char *name)
+{
+  static const u8g2_uint_t len_list[] = { 1, 2, 4, 7, 8, 16, 31, 64, 120 };
+  uint8_t dir, color;
+  unsigned i;
+
+  for( dir = 0; dir < 2; dir++ )
+  {
+    for( i = 0; i < sizeof(len_list)/sizeof(*len_list); i++ )
+    {
+      if ( dir == 1 && len_list[i] > 56 )
+        break;
+      printf("%-22s dir=%d len=%3d", name, dir, len_list[i]);
+      for( color = 0; color < 3; color++ )
+        printf("  c%d: %7.1f ns", color, measure(dir, len_list[i], color));
+      printf("\n");
+    }
+  }
+}
+
+int main(void)
+{
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  measure_all("vertical_top_lsb");
+
+  u8g2_Setup_sh1122_256x64_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  measure_all("horizontal_right_lsb");
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+/*
+
+  kerning_speed
+
+  Measure u8g2_GetKerning for a kerning table similar to the tables 
+  written by bdfconv for a unifont arabic font (500 first glyphs with 
+  70 second glyphs each). The kerning pairs of a text line are looked up
+  once per page (8 pages per frame), with and without kerning cache 
+  (u8g2_SetKerningCache). The linear search of the previous 
+  u8g2_GetKerning is included for comparison.
+  Output is the time in nanoseconds per lookup.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 2000UL
+#define PAGES 8
+#define FIRST_CNT 500
+#define SECOND_CNT 70
+#define PAIR_CNT 24
+
+u8g2_t u8g2;
+u8g2_kerning_cache_t kerning_cache[32];
+
+uint16_t first_encoding_table[FIRST_CNT+1];
+uint16_t index_to_second_table[FIRST_CNT+1];
+uint16_t second_encoding_table[FIRST_CNT*SECOND_CNT];
+uint8_t kerning_values[FIRST_CNT*SECOND_CNT];
+u8g2_kerning_t kerning = { FIRST_CNT+1, FIRST_CNT*SECOND_CNT, 
+  first_encoding_table, index_to_second_table, second_encoding_table, kerning_values, 1 };
+
+uint16_t text[PAIR_CNT+1];
+
+static void build_table(void)
+{
+  uint16_t i, j;
+  for( i = 0; i < FIRST_CNT; i++ )
+  {
+    first_encoding_table[i] = 0x600 + i;
+    index_to_second_table[i] = i*SECOND_CNT;
+    for( j = 0; j < SECOND_CNT; j++ )
+    {
+      second_encoding_table[i*SECOND_CNT+j] = 0x600 + j*7;
+      kerning_values[i*SECOND_CNT+j] = (i+j) & 3;
+    }
+  }
+  first_encoding_table[FIRST_CNT] = 0x0ffff;
+  index_to_second_table[FIRST_CNT] = FIRST_CNT*SECOND_CNT;
+  for( i = 0; i <= PAIR_CNT; i++ )
+    text[i] = 0x600 + ((i*37) % 300);
+}
+
+static uint8_t linear_get_kerning(u8g2_kerning_t *kerning, uint16_t e1, uint16_t e2)
+{
+  uint16_t i1, i2, cnt, end;
+  cnt = kerning->first_table_cnt-1;
+  for( i1 = 0; i1 < cnt; i1++ )
+    if ( kerning->first_encoding_table[i1] == e1 )
+      break;
+  if ( i1 >= cnt )
+    return 0;
+  end = kerning->index_to_second_table[i1+1];
+  for( i2 = kerning->index_to_second_table[i1]; i2 < end; i2++ )
+    if ( kerning->second_encoding_table[i2] == e2 )
+      break;
+  if ( i2 >= end )
+    return 0;
+  return kerning->kerning_values[i2];
+}
+
+static double measure(int is_linear)
+{
+  unsigned long i;
+  unsigned page, j;
+  volatile uint8_t k;
+  double t;
+  
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+    for( page = 0; page < PAGES; page++ )
+      for( j = 0; j < PAIR_CNT; j++ )
+	if ( is_linear )
+	  k = linear_get_kerning(&kerning, text[j], text[j+1]);
+	else
+	  k = u8g2_GetKerning(&u8g2, &kerning, text[j], text[j+1]);
+  t = bench_get_ns() - t;
+  (void)k;
+  return t / (double)LOOPS / (double)PAGES / (double)PAIR_CNT;
+}
+
+int main(void)
+{
+  double t0, t1, t2;
+  
+  build_table();
+  u8g2_Setup_ssd1306_128x64_noname_1(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  t0 = measure(1);
+  t1 = measure(0);
+  u8g2_SetKerningCache(&u8g2, kerning_cache, sizeof(kerning_cache)/sizeof(*kerning_cache));
+  t2 = measure(0);
+  printf("kerning cache RAM: %u bytes\n", (unsigned)sizeof(kerning_cache));
+  printf("linear: %7.1f ns  binary search: %7.1f ns  binary search with cache: %7.1f ns\n", t0, t1, t2);
+  return 0;
+}
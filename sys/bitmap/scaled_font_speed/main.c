@@ -0,0 +1,80 @@
+/*
+
+  scaled_font_speed
+
+  Draw a numeric readout with u8g2_DrawStrScaled() (scale 2, 3 and 4) 
+  into a SSD1306 full buffer in transparent and solid mode and report
+  the time per glyph.
+  "make test" compares the scaled bitmap procedure with the run length
+  procedure (U8G2_WITHOUT_FONT_SCALE_BITMAP) and reports the speedup 
+  against the results of the classic build (see bench.c).
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 5000UL
+
+u8g2_t u8g2;
+
+static const char str[] = "42.7";
+#define GLYPH_CNT 4
+
+/* best of 5 runs */
+static double measure(uint8_t scale, uint8_t is_transparent)
+{
+  unsigned long i;
+  unsigned run;
+  double t, best = 1.0E30;
+  
+  u8g2_SetFontMode(&u8g2, is_transparent);
+  for( run = 0; run < 5; run++ )
+  {
+    t = bench_get_ns();
+    for( i = 0; i < LOOPS; i++ )
+      u8g2_DrawStrScaled(&u8g2, 0, 60, scale, str);
+    t = bench_get_ns() - t;
+    if ( best > t )
+      best = t;
+  }
+  return best / (double)LOOPS / (double)GLYPH_CNT;
+}
+
+static void measure_font(const char *name, const uint8_t *font)
+{
+  uint8_t scale;
+  double transparent, solid, transparent_ref, solid_ref;
+  
+  u8g2_SetFont(&u8g2, font);
+  for( scale = 2; scale <= 4; scale++ )
+  {
+    transparent = measure(scale, 1);
+    solid = measure(scale, 0);
+    transparent_ref = bench_ref(transparent);
+    solid_ref = bench_ref(solid);
+    printf("%-12s scale=%d  transparent: %7.1f ns/glyph  solid: %7.1f ns/glyph", name, scale, transparent, solid);
+    if ( transparent_ref > 0.0 && solid_ref > 0.0 )
+      printf("  speedup %5.2f %5.2f", transparent_ref/transparent, solid_ref/solid);
+    printf("\n");
+  }
+}
+
+int main(int argc, char **argv)
+{
+  if ( bench_ref_init(argc, argv) == 0 )
+    return 1;
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SetDrawColor(&u8g2, 1);
+#ifdef U8G2_WITH_FONT_SCALE_BITMAP
+  printf("scaled bitmap\n");
+#else
+  printf("scaled run length\n");
+#endif
+  measure_font("6x10_tf", u8g2_font_6x10_tf);
+  measure_font("helvB08_tr", u8g2_font_helvB08_tr);
+  bench_ref_done();
+  return 0;
+}
@@ -0,0 +1,122 @@
+/*
+
+  send_step_speed
+
+  Send a SSD1306 128x64 I2C full buffer with u8g2_SendBuffer() and with
+  u8g2_SendBufferBegin() / u8g2_SendBufferStep(budget) / u8g2_SendBufferDone()
+  for different budgets (tiles per step).
+  
+  The bus is simulated with a fake clock: Each byte advances the clock by 
+  the time on a 400 kHz I2C bus (9 bit), each transfer by the time for 
+  start condition, address byte and stop condition. The output is the 
+  number of steps and the longest step, which has to fit into the
+  1 ms control loop of the application.
+  The display memory is captured with the bitmap device and compared with 
+  the u8g2 buffer after each send.
+
+*/
+
+#include "u8g2.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BYTE_NS 22500UL
+#define TRANSFER_NS (BYTE_NS+5000UL)
+#define DEADLINE_NS 1000000UL
+
+u8g2_t u8g2;
+
+static unsigned long fake_ns;
+
+static uint8_t u8x8_byte_fake_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  switch(msg)
+  {
+    case U8X8_MSG_BYTE_SEND:
+      fake_ns += arg_int*BYTE_NS;
+      break;
+    case U8X8_MSG_BYTE_START_TRANSFER:
+      fake_ns += TRANSFER_NS;
+      break;
+    case U8X8_MSG_BYTE_INIT:
+    case U8X8_MSG_BYTE_SET_DC:
+    case U8X8_MSG_BYTE_END_TRANSFER:
+      break;
+    default:
+      return 0;
+  }
+  return 1;
+}
+
+static void setup(void)
+{
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_fake_i2c, u8x8_dummy_cb);
+  u8x8_ConnectBitmapToU8x8(u8g2_GetU8x8(&u8g2));
+  u8g2_InitDisplay(&u8g2);
+  u8g2_SetPowerSave(&u8g2, 0);
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SetFont(&u8g2, u8g2_font_ncenB14_tr);
+  u8g2_DrawStr(&u8g2, 0, 20, "Send Step");
+  u8g2_DrawFrame(&u8g2, 0, 30, 128, 34);
+  u8g2_DrawDisc(&u8g2, 100, 47, 12, U8G2_DRAW_ALL);
+}
+
+/* compare the captured display memory with the buffer */
+static int check(void)
+{
+  uint8_t *buf = u8g2_GetBufferPtr(&u8g2);
+  uint16_t x, y;
+  int err = 0;
+  
+  for( y = 0; y < 64; y++ )
+    for( x = 0; x < 128; x++ )
+      if ( u8x8_GetBitmapPixel(u8g2_GetU8x8(&u8g2), x, y) != ((buf[(y/8)*128+x] >> (y&7)) & 1) )
+	err++;
+  return err;
+}
+
+static int measure_step(uint16_t budget)
+{
+  unsigned long t, max_ns = 0, steps = 0, total;
+  uint8_t is_more;
+  int err;
+  
+  setup();
+  fake_ns = 0;
+  u8g2_SendBufferBegin(&u8g2);
+  do
+  {
+    t = fake_ns;
+    is_more = u8g2_SendBufferStep(&u8g2, budget);
+    t = fake_ns - t;
+    if ( max_ns < t )
+      max_ns = t;
+    steps++;
+    /* the control loop of the application would run here */
+  } while( is_more );
+  u8g2_SendBufferDone(&u8g2);
+  total = fake_ns;
+  err = check();
+  printf("budget %3u tiles: %4lu steps, longest step %8.1f us%s, total %8.1f us, %s\n", 
+    budget, steps, max_ns/1000.0, max_ns > DEADLINE_NS ? " (deadline missed)" : "", 
+    total/1000.0, err == 0 ? "ok" : "display memory differs");
+  return err;
+}
+
+int main(void)
+{
+  static const uint16_t budget_list[] = { 1, 2, 4, 8, 16, 32, 128 };
+  unsigned i;
+  int err;
+  
+  setup();
+  fake_ns = 0;
+  u8g2_SendBuffer(&u8g2);
+  err = check();
+  printf("u8g2_SendBuffer:   %4u steps, longest step %8.1f us%s, %s\n", 1, fake_ns/1000.0, 
+    fake_ns > DEADLINE_NS ? " (deadline missed)" : "", err == 0 ? "ok" : "display memory differs");
+  
+  for( i = 0; i < sizeof(budget_list)/sizeof(*budget_list); i++ )
+    err += measure_step(budget_list[i]);
+  return err != 0;
+}
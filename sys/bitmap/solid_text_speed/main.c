@@ -0,0 +1,80 @@
+/*
+
+  solid_text_speed
+
+  Draw a menu line in solid font mode (u8g2_SetFontMode(u8g2, 0)) with 
+  draw color 0 (inverted) and 1 into a SSD1306 full buffer and report 
+  the time per glyph. Transparent mode is included for reference.
+  "make test" compares the solid mode box fill with the background runs
+  of u8g2_font_decode_len() (U8G2_WITHOUT_FONT_SOLID_BOX) and reports the
+  speedup against the results of the classic build (see bench.c).
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 20000UL
+
+u8g2_t u8g2;
+
+static const char str[] = "Settings 42";
+#define GLYPH_CNT 11
+
+/* best of 5 runs */
+static double measure(uint8_t color, uint8_t is_transparent)
+{
+  unsigned long i;
+  unsigned run;
+  double t, best = 1.0E30;
+  
+  u8g2_SetDrawColor(&u8g2, color);
+  u8g2_SetFontMode(&u8g2, is_transparent);
+  for( run = 0; run < 5; run++ )
+  {
+    t = bench_get_ns();
+    for( i = 0; i < LOOPS; i++ )
+      u8g2_DrawStr(&u8g2, 2, 20, str);
+    t = bench_get_ns() - t;
+    if ( best > t )
+      best = t;
+  }
+  return best / (double)LOOPS / (double)GLYPH_CNT;
+}
+
+static void measure_font(const char *name, const uint8_t *font)
+{
+  double t[3], ref[3];
+  uint8_t i;
+  
+  u8g2_SetFont(&u8g2, font);
+  t[0] = measure(1, 1);
+  t[1] = measure(1, 0);
+  t[2] = measure(0, 0);
+  for( i = 0; i < 3; i++ )
+    ref[i] = bench_ref(t[i]);
+  printf("%-16s transparent: %6.1f ns/glyph  solid: %6.1f ns/glyph  inverted: %6.1f ns/glyph", 
+    name, t[0], t[1], t[2]);
+  if ( ref[0] > 0.0 && ref[1] > 0.0 && ref[2] > 0.0 )
+    printf("  speedup %5.2f %5.2f %5.2f", ref[0]/t[0], ref[1]/t[1], ref[2]/t[2]);
+  printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  if ( bench_ref_init(argc, argv) == 0 )
+    return 1;
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_ClearBuffer(&u8g2);
+#ifdef U8G2_WITH_FONT_SOLID_BOX
+  printf("solid mode box fill\n");
+#else
+  printf("background runs\n");
+#endif
+  measure_font("6x10_tf", u8g2_font_6x10_tf);
+  measure_font("helvB08_tr", u8g2_font_helvB08_tr);
+  measure_font("ncenB14_tr", u8g2_font_ncenB14_tr);
+  bench_ref_done();
+  return 0;
+}
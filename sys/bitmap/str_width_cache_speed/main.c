@@ -0,0 +1,62 @@
+/*
+
+  str_width_cache_speed
+
+  Measure u8g2_GetUTF8Width for centered labels in page mode with and
+  without the string width cache (u8g2_SetStrWidthCache). The labels
+  are measured once per page, this is 8 times per frame for the
+  SSD1306 128x64 with one page buffer.
+  Output is the time in microseconds for the width calculation of one frame.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 2000UL
+#define PAGES 8
+
+u8g2_t u8g2;
+u8g2_str_width_cache_t str_width_cache[16];
+
+static const char *labels[] = { "Settings", "Display Brightness", "Network: connected", "Back" };
+#define LABEL_CNT 4
+
+static double measure_frame(void)
+{
+  unsigned long i;
+  unsigned page, j;
+  volatile u8g2_uint_t x;
+  double t;
+  
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+  {
+    for( page = 0; page < PAGES; page++ )
+    {
+      u8g2_SetFont(&u8g2, u8g2_font_ncenB14_tr);
+      x = (128 - u8g2_GetUTF8Width(&u8g2, labels[0])) / 2;
+      u8g2_SetFont(&u8g2, u8g2_font_helvB08_tr);
+      for( j = 1; j < LABEL_CNT; j++ )
+	x = (128 - u8g2_GetUTF8Width(&u8g2, labels[j])) / 2;
+    }
+  }
+  t = bench_get_ns() - t;
+  (void)x;
+  return t / (double)LOOPS / 1000.0;
+}
+
+int main(void)
+{
+  double t0, t1;
+  
+  u8g2_Setup_ssd1306_128x64_noname_1(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  t0 = measure_frame();
+  u8g2_SetStrWidthCache(&u8g2, str_width_cache, sizeof(str_width_cache)/sizeof(*str_width_cache));
+  t1 = measure_frame();
+  printf("str width cache RAM: %u bytes\n", (unsigned)sizeof(str_width_cache));
+  printf("without cache: %7.2f us/frame  with cache: %7.2f us/frame  hit: %u  miss: %u\n", 
+    t0, t1, u8g2_GetStrWidthCacheHitCnt(&u8g2), u8g2_GetStrWidthCacheMissCnt(&u8g2));
+  return 0;
+}
@@ -0,0 +1,51 @@
+/*
+
+  unicode_lookup_speed
+
+  Measure u8g2_GetUTF8Width for a chinese string with and without
+  the glyph cache (u8g2_SetFontGlyphCache). The width calculation 
+  mainly consists of the glyph lookup.
+  Output is the time in nanoseconds per glyph.
+
+*/
+
+#include "u8g2.h"
+#include "bench.h"
+#include <stdio.h>
+
+#define LOOPS 20000UL
+
+u8g2_t u8g2;
+u8g2_font_glyph_cache_t glyph_cache[32];
+
+/* "你好世界 设置 菜单 返回 时间" */
+static const char str[] = "\xe4\xbd\xa0\xe5\xa5\xbd\xe4\xb8\x96\xe7\x95\x8c \xe8\xae\xbe\xe7\xbd\xae \xe8\x8f\x9c\xe5\x8d\x95 \xe8\xbf\x94\xe5\x9b\x9e \xe6\x97\xb6\xe9\x97\xb4";
+#define GLYPH_CNT 16
+
+static double measure_width(void)
+{
+  unsigned long i;
+  volatile u8g2_uint_t w;
+  double t;
+  
+  t = bench_get_ns();
+  for( i = 0; i < LOOPS; i++ )
+    w = u8g2_GetUTF8Width(&u8g2, str);
+  t = bench_get_ns() - t;
+  (void)w;
+  return t / (double)LOOPS / (double)GLYPH_CNT;
+}
+
+int main(void)
+{
+  double t0, t1;
+  
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_SetFont(&u8g2, u8g2_font_unifont_t_chinese2);
+  t0 = measure_width();
+  u8g2_SetFontGlyphCache(&u8g2, glyph_cache, sizeof(glyph_cache)/sizeof(*glyph_cache));
+  t1 = measure_width();
+  printf("glyph cache RAM: %u bytes\n", (unsigned)sizeof(glyph_cache));
+  printf("unifont_t_chinese2  without cache: %7.1f ns  with cache: %7.1f ns\n", t0, t1);
+  return 0;
+}
@@ -1,5 +1,6 @@
 #include <errno.h>
 #include <fcntl.h>
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>
 #include <linux/i2c-dev.h>
 #include <i2c/smbus.h>
@@ -24,6 +25,52 @@ int file = 1;
 uint8_t addr = 0x3c;
 int adapter_nr = 0; /* probably dynamically determined */
 
+/*
+ * batch mode: each START/END pair becomes one i2c_msg, all messages
+ * are sent with one I2C_RDWR ioctl, see u8x8_linux_i2c_batch_start()
+ * the kernel accepts at most I2C_RDWR_IOCTL_MAX_MSGS messages per ioctl
+ */
+static int is_batch = 0;
+static int batch_cnt = 0;
+static struct i2c_msg batch_msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+static uint8_t batch_data[I2C_RDWR_IOCTL_MAX_MSGS][BUFSIZ_I2C];
+
+static int batch_flush(void)
+{
+	struct i2c_rdwr_ioctl_data rdwr;
+
+	if (batch_cnt == 0)
+		return 0;
+	rdwr.msgs = batch_msgs;
+	rdwr.nmsgs = batch_cnt;
+	batch_cnt = 0;
+	if (ioctl(file, I2C_RDWR, &rdwr) < 0) {
+		fprintf(stderr, "can't write %d msgs: %s\n", rdwr.nmsgs, strerror(errno));
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * collect all transfers until u8x8_linux_i2c_batch_end(), e.g.
+ *	u8x8_linux_i2c_batch_start();
+ *	u8g2_SendBuffer(&u8g2);
+ *	u8x8_linux_i2c_batch_end();
+ * a full 128x64 SSD1306 frame is sent with two ioctl calls instead of 64
+ */
+void u8x8_linux_i2c_batch_start(void)
+{
+	batch_cnt = 0;
+	is_batch = 1;
+}
+
+/* send the collected transfers, returns 0 on success */
+int u8x8_linux_i2c_batch_end(void)
+{
+	is_batch = 0;
+	return batch_flush();
+}
+
 
 uint8_t
 u8x8_byte_linux_i2c(u8x8_t *u8x8,
@@ -67,6 +114,17 @@ u8x8_byte_linux_i2c(u8x8_t *u8x8,
 		idx = 0;
 		break;
 	case U8X8_MSG_BYTE_END_TRANSFER:
+		if (is_batch) {
+			memcpy(batch_data[batch_cnt], data, idx);
+			batch_msgs[batch_cnt].addr = addr;
+			batch_msgs[batch_cnt].flags = 0;
+			batch_msgs[batch_cnt].len = idx;
+			batch_msgs[batch_cnt].buf = batch_data[batch_cnt];
+			batch_cnt++;
+			if (batch_cnt == I2C_RDWR_IOCTL_MAX_MSGS && batch_flush() < 0)
+				return(errno);
+			break;
+		}
 		//fprintf(stderr, "++ end transfer, sending cmd %0x %0x count %d\n", data[0], data[1], idx);
 		// NB! note the extre _i2c_ in there! leave that out and you are screwed
 		if (i2c_smbus_write_i2c_block_data(file, data[0], idx - 1, &data[1]) < 0) {
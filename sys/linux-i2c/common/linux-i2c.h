@@ -1,5 +1,5 @@
-#ifndef _LINUX_I2C_H
-#define _LINUX_I2C_H	1
+#ifndef _U8X8_LINUX_I2C_H
+#define _U8X8_LINUX_I2C_H	1
 
 
 
@@ -21,5 +21,8 @@ uint8_t u8x8_byte_linux_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *ar
 
 uint8_t u8x8_linux_i2c_delay (u8x8_t * u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr) ;
 
+void u8x8_linux_i2c_batch_start(void);
+int u8x8_linux_i2c_batch_end(void);
+
 
 #endif // LINUXi2c
@@ -0,0 +1,154 @@
+/*
+
+  i2c_batch_speed
+
+  Send a SSD1306 128x64 full buffer with u8x8_byte_linux_i2c, once with 
+  one SMBus block write per transfer and once with the transfers of the 
+  frame collected into I2C_RDWR ioctl calls 
+  (u8x8_linux_i2c_batch_start() / u8x8_linux_i2c_batch_end()).
+
+  No hardware is required: ioctl() is replaced by a stand-in i2c device,
+  which records the bus traffic and then issues the real ioctl syscall on
+  /dev/null, so that the kernel entry is included in the measurement.
+  The time on the wire is not included.
+  Output: ioctl calls and time per frame, and whether both modes produce
+  the same bus traffic.
+
+*/
+
+#include <linux-i2c.h>
+#include <u8g2.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <i2c/smbus.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <sys/syscall.h>
+
+#define FRAMES 2000UL
+
+/* i2c file descriptor of linux-i2c.c */
+extern int file;
+
+u8g2_t u8g2;
+
+/*=================================================*/
+/* stand-in i2c device */
+
+static unsigned long ioctl_cnt;
+static unsigned long bus_hash;
+
+static void bus_msg(const uint8_t *buf, unsigned len)
+{
+  bus_hash = bus_hash*33 + 0x100;	/* start condition */
+  while( len-- > 0 )
+    bus_hash = bus_hash*33 + *buf++;
+}
+
+int ioctl(int fd, unsigned long request, ...)
+{
+  va_list va;
+  void *arg;
+  struct i2c_smbus_ioctl_data *smbus;
+  struct i2c_rdwr_ioctl_data *rdwr;
+  unsigned i;
+  
+  va_start(va, request);
+  arg = va_arg(va, void *);
+  va_end(va);
+  
+  ioctl_cnt++;
+  switch(request)
+  {
+    case I2C_SMBUS:
+      smbus = arg;
+      bus_hash = bus_hash*33 + 0x100;
+      bus_hash = bus_hash*33 + smbus->command;
+      for( i = 1; i <= smbus->data->block[0]; i++ )
+	bus_hash = bus_hash*33 + smbus->data->block[i];
+      break;
+    case I2C_RDWR:
+      rdwr = arg;
+      for( i = 0; i < rdwr->nmsgs; i++ )
+	bus_msg(rdwr->msgs[i].buf, rdwr->msgs[i].len);
+      break;
+  }
+  /* /dev/null answers with ENOTTY, only the syscall overhead is measured */
+  syscall(SYS_ioctl, fd, request, arg);
+  return 0;
+}
+
+/* same as libi2c */
+__s32 i2c_smbus_write_i2c_block_data(int file, __u8 command, __u8 length, const __u8 *values)
+{
+  union i2c_smbus_data data;
+  struct i2c_smbus_ioctl_data args;
+  int i;
+  
+  if ( length > I2C_SMBUS_BLOCK_MAX )
+    length = I2C_SMBUS_BLOCK_MAX;
+  for( i = 1; i <= length; i++ )
+    data.block[i] = values[i-1];
+  data.block[0] = length;
+  args.read_write = I2C_SMBUS_WRITE;
+  args.command = command;
+  args.size = I2C_SMBUS_I2C_BLOCK_DATA;
+  args.data = &data;
+  return ioctl(file, I2C_SMBUS, &args);
+}
+
+/*=================================================*/
+
+static double get_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec*1.0E9 + (double)ts.tv_nsec;
+}
+
+static double measure(int is_batch, unsigned long *hash)
+{
+  unsigned long i;
+  double t;
+  
+  ioctl_cnt = 0;
+  t = get_ns();
+  for( i = 0; i < FRAMES; i++ )
+  {
+    bus_hash = 5381;
+    if ( is_batch )
+      u8x8_linux_i2c_batch_start();
+    u8g2_SendBuffer(&u8g2);
+    if ( is_batch )
+      u8x8_linux_i2c_batch_end();
+  }
+  t = get_ns() - t;
+  *hash = bus_hash;
+  return t / (double)FRAMES;
+}
+
+int main(void)
+{
+  unsigned long hash_single, hash_batch;
+  double t;
+  
+  file = open("/dev/null", O_RDWR);
+  if ( file < 0 )
+  {
+    perror("/dev/null");
+    return 1;
+  }
+  
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_linux_i2c, u8x8_linux_i2c_delay);
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SetFont(&u8g2, u8g2_font_ncenB14_tr);
+  u8g2_DrawStr(&u8g2, 0, 20, "I2C batch");
+  u8g2_DrawFrame(&u8g2, 0, 30, 128, 34);
+  
+  t = measure(0, &hash_single);
+  printf("single transfers: %5.1f ioctl/frame %9.1f ns/frame\n", (double)ioctl_cnt/(double)FRAMES, t);
+  t = measure(1, &hash_batch);
+  printf("I2C_RDWR batch:   %5.1f ioctl/frame %9.1f ns/frame\n", (double)ioctl_cnt/(double)FRAMES, t);
+  printf("bus traffic: %s\n", hash_single == hash_batch ? "same" : "differs");
+  return hash_single == hash_batch ? 0 : 1;
+}
@@ -2958,7 +2958,10 @@ void do_display(int controller_idx, int display_idx, const char *postfix)
   fprintf(setup_code_fp, "  buf = ");
   //fprintf(setup_code_fp, "u8g2_m_%s_%d_%s(&tile_buf_height);\n", strlowercase(controller_list[controller_idx].name), controller_list[controller_idx].tile_width, postfix);
   fprintf(setup_code_fp, "u8g2_m_%d_%d_%s(&tile_buf_height);\n", controller_list[controller_idx].tile_width, controller_list[controller_idx].tile_height, postfix);
-  fprintf(setup_code_fp, "  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, %s, rotation);\n", controller_list[controller_idx].ll_hvline);
+  if ( postfix[0] == 'g' )
+    fprintf(setup_code_fp, "  u8g2_SetupGrayBuffer(u8g2, buf, tile_buf_height, %c, rotation);\n", postfix[1]);	/* "g4_f" --> 4 bit per pixel */
+  else
+    fprintf(setup_code_fp, "  u8g2_SetupBuffer(u8g2, buf, tile_buf_height, %s, rotation);\n", controller_list[controller_idx].ll_hvline);
   fprintf(setup_code_fp, "}\n");
   
   /* generate interfaces for this display */
@@ -3020,6 +3023,11 @@ void do_controller_buffer_code(int idx, const char *postfix, int buf_len, int ro
   {
     str_add(s);
     //FILE *fp = stdout;
+    if ( postfix[0] == 'g' )
+    {
+      fprintf(buf_code_fp, "#ifdef U8G2_WITH_GRAY_BUFFER\n");
+      fprintf(buf_header_fp, "#ifdef U8G2_WITH_GRAY_BUFFER\n");
+    }
     fprintf(buf_code_fp, "uint8_t *%s(uint8_t *page_cnt)\n", s);
     fprintf(buf_code_fp, "{\n");
     fprintf(buf_code_fp, "  #ifdef U8G2_USE_DYNAMIC_ALLOC\n");
@@ -3033,18 +3041,51 @@ void do_controller_buffer_code(int idx, const char *postfix, int buf_len, int ro
     fprintf(buf_code_fp, "}\n");
     
     fprintf(buf_header_fp, "uint8_t *%s(uint8_t *page_cnt);\n", s);
+    if ( postfix[0] == 'g' )
+    {
+      fprintf(buf_code_fp, "#endif /* U8G2_WITH_GRAY_BUFFER */\n");
+      fprintf(buf_header_fp, "#endif /* U8G2_WITH_GRAY_BUFFER */\n");
+    }
   }
   
   display_idx = 0;
   fprintf(setup_code_fp, "/* %s %s */\n", controller_list[idx].name, postfix);
+  if ( postfix[0] == 'g' )
+  {
+    /* gray level buffers, setup procedures and constructors need U8G2_WITH_GRAY_BUFFER */
+    fprintf(setup_code_fp, "#ifdef U8G2_WITH_GRAY_BUFFER\n");
+    fprintf(setup_header_fp, "#ifdef U8G2_WITH_GRAY_BUFFER\n");
+    fprintf(u8g2_cpp_header_fp, "#ifdef U8G2_WITH_GRAY_BUFFER\n");
+  }
   while( controller_list[idx].display_list[display_idx].name != NULL )
   {
     do_display(idx, display_idx, postfix);
     display_idx++;
   }
+  if ( postfix[0] == 'g' )
+  {
+    fprintf(setup_code_fp, "#endif /* U8G2_WITH_GRAY_BUFFER */\n");
+    fprintf(setup_header_fp, "#endif /* U8G2_WITH_GRAY_BUFFER */\n");
+    fprintf(u8g2_cpp_header_fp, "#endif /* U8G2_WITH_GRAY_BUFFER */\n");
+  }
   
 }
 
+/*
+  controller with a native gray level buffer (U8X8_MSG_DISPLAY_DRAW_GRAY_TILE)
+  the ssd1322 128x64 display is excluded: it only uses every second column (u8x8_d_ssd1322_common2)
+*/
+int is_gray_controller(int idx)
+{
+  if ( strcmp(controller_list[idx].name, "ssd1327") == 0 )
+    return 1;
+  if ( strcmp(controller_list[idx].name, "sh1122") == 0 )
+    return 1;
+  if ( strcmp(controller_list[idx].name, "ssd1322") == 0 && controller_list[idx].tile_width >= 30 )
+    return 1;
+  return 0;
+}
+
 
 
 void do_controller_list(void)
@@ -3057,6 +3098,15 @@ void do_controller_list(void)
     do_controller_buffer_code(i, "1", controller_list[i].tile_width*8, 1);
     do_controller_buffer_code(i, "2", controller_list[i].tile_width*8*2, 2);
     do_controller_buffer_code(i, "f", controller_list[i].tile_width*8*controller_list[i].tile_height, controller_list[i].tile_height);
+    if ( is_gray_controller(i) )
+    {
+      do_controller_buffer_code(i, "g4_1", controller_list[i].tile_width*8*4, 1);
+      do_controller_buffer_code(i, "g4_2", controller_list[i].tile_width*8*4*2, 2);
+      do_controller_buffer_code(i, "g4_f", controller_list[i].tile_width*8*4*controller_list[i].tile_height, controller_list[i].tile_height);
+      do_controller_buffer_code(i, "g2_1", controller_list[i].tile_width*8*2, 1);
+      do_controller_buffer_code(i, "g2_2", controller_list[i].tile_width*8*2*2, 2);
+      do_controller_buffer_code(i, "g2_f", controller_list[i].tile_width*8*2*controller_list[i].tile_height, controller_list[i].tile_height);
+    }
     printf("\n");
   }
 }
@@ -43,6 +43,7 @@ bf_t *bf_Open(int is_verbose, int bbx_mode)
     bf->target_data = NULL;
     bf->target_max = 0;
     bf->target_cnt = 0;
+    bf->offset_table_mode = BDF_OFFSET_TABLE_NONE;
     bf->selected_glyphs = 0;
     
     bf->enc_w = 0;
@@ -608,6 +609,9 @@ int bf_WriteU8G2CByFP(bf_t *bf, FILE *out_fp, const char *fontname, const char *
   int i;
   int bytes_per_line = 32;
   int extra1;
+  uint8_t *target_data = bf->target_data;
+  int target_cnt = bf->target_cnt;
+  uint8_t *offset_table_font = NULL;
   
   fprintf(out_fp, "/*\n");
   fprintf(out_fp, "  Fontname: %s\n", bf->str_font);
@@ -616,12 +620,20 @@ int bf_WriteU8G2CByFP(bf_t *bf, FILE *out_fp, const char *fontname, const char *
   fprintf(out_fp, "  BBX Build Mode: %d\n", (int)bf->bbx_mode);
   fprintf(out_fp, "*/\n");
 
-  if ( bf->target_data[bf->target_cnt-1] == 0 )
+  /* the offset table is not part of bf->target_data, so that the kerning and tga procedures still work */
+  if ( bf->bbx_mode != BDF_BBX_MODE_M8 )
+  {
+    offset_table_font = bf_RLECreateOffsetTableFont(bf, &target_cnt);
+    if ( offset_table_font != NULL )
+      target_data = offset_table_font;
+  }
+
+  if ( target_data[target_cnt-1] == 0 )
     extra1 = 0;
   else
     extra1 = 1;
   
-  if ( bf->target_cnt-1+extra1 > 32760 )
+  if ( target_cnt-1+extra1 > 32760 )
   {
     fprintf(out_fp, "#ifdef U8G2_USE_LARGE_FONTS\n");    
   }
@@ -629,29 +641,29 @@ int bf_WriteU8G2CByFP(bf_t *bf, FILE *out_fp, const char *fontname, const char *
   if ( bf->bbx_mode == 3 )	// maybe better check for the font_format
   {
     //fprintf(out_fp, "#include \"u8x8.h\"\n");  
-    fprintf(out_fp, "const uint8_t %s[%d] U8X8_FONT_SECTION(\"%s\") = \n", fontname, bf->target_cnt+extra1, fontname);
+    fprintf(out_fp, "const uint8_t %s[%d] U8X8_FONT_SECTION(\"%s\") = \n", fontname, target_cnt+extra1, fontname);
   }
   else
   {
     //fprintf(out_fp, "#include \"u8g2.h\"\n");  
-    fprintf(out_fp, "const uint8_t %s[%d] U8G2_FONT_SECTION(\"%s\") = \n", fontname, bf->target_cnt+extra1, fontname);
+    fprintf(out_fp, "const uint8_t %s[%d] U8G2_FONT_SECTION(\"%s\") = \n", fontname, target_cnt+extra1, fontname);
   }
   fprintf(out_fp, "%s\"", indent);
     
-  for( i = 0; i < bf->target_cnt-1+extra1; i++ )
+  for( i = 0; i < target_cnt-1+extra1; i++ )
   {
-    if ( bf->target_data[i] < 32 || bf->target_data[i] == '\"' || bf->target_data[i] == '\\'  || bf->target_data[i] == '?' || ( bf->target_data[i] >= '0' && bf->target_data[i] <= '9' ))
+    if ( target_data[i] < 32 || target_data[i] == '\"' || target_data[i] == '\\'  || target_data[i] == '?' || ( target_data[i] >= '0' && target_data[i] <= '9' ))
     {
-      fprintf(out_fp, "\\%o", bf->target_data[i]);
-      //fprintf(out_fp, "\\x%02x", bf->target_data[i]);
+      fprintf(out_fp, "\\%o", target_data[i]);
+      //fprintf(out_fp, "\\x%02x", target_data[i]);
     }
-    else if ( bf->target_data[i] < 127 )		/* issue 482, do not output ASCII char 127, instead use octal code for 127 */
+    else if ( target_data[i] < 127 )		/* issue 482, do not output ASCII char 127, instead use octal code for 127 */
     {
-      fprintf(out_fp, "%c", bf->target_data[i]);
+      fprintf(out_fp, "%c", target_data[i]);
     }
     else
     {
-      fprintf(out_fp, "\\%o", bf->target_data[i]);
+      fprintf(out_fp, "\\%o", target_data[i]);
     }
     if ( (i+1) % bytes_per_line == 0 )
       fprintf(out_fp, "\"\n%s\"", indent); 
@@ -659,11 +671,12 @@ int bf_WriteU8G2CByFP(bf_t *bf, FILE *out_fp, const char *fontname, const char *
 
   fprintf(out_fp, "\";\n");  
 
-  if ( bf->target_cnt-1+extra1 > 32760 )
+  if ( target_cnt-1+extra1 > 32760 )
   {
     fprintf(out_fp, "#endif /* U8G2_USE_LARGE_FONTS */\n");    
   }
   
+  free(offset_table_font);
   return 1;
 }
 
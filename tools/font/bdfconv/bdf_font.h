@@ -19,6 +19,10 @@
 #define BDF_BBX_MODE_M8 3
 #define BDF_BBX_MODE_5X7 4
 
+#define BDF_OFFSET_TABLE_NONE 0
+#define BDF_OFFSET_TABLE_DENSE 1
+#define BDF_OFFSET_TABLE_SPARSE 2
+
 struct _bdf_font_struct
 {
   int is_verbose;
@@ -82,6 +86,7 @@ struct _bdf_font_struct
   int target_max;
   int target_cnt;
   
+  int offset_table_mode;	/* glyph offset table for the u8g2 font, one of BDF_OFFSET_TABLE_xxx */
 
   int tile_h_size;	// new 2019 8x8 font format
   int tile_v_size;	// new 2019 8x8 font format
@@ -124,6 +129,7 @@ void bf_CalculateMinMaxDWidth(bf_t *bf);
 void bf_copy_bbx_and_update_shift(bf_t *bf, bbx_t *target_bbx, bg_t *bg);
 void bf_CalculateMaxBitFieldSize(bf_t *bf);
 void bf_RLECompressAllGlyphs(bf_t *bf);
+uint8_t *bf_RLECreateOffsetTableFont(bf_t *bf, int *cnt);
 void bf_Generate8x8Font(bf_t *bf, int xo, int yo);
 
 
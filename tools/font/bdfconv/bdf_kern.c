@@ -5,6 +5,7 @@
 */
 
 #include "bdf_font.h"
+#include <stdlib.h>
 #include <assert.h>
 
 #define BDF_KERNING_MAX (1024*60)
@@ -78,7 +79,7 @@ void bdf_write_kerning_file(const char *kernfile, const char *name)
   FILE *fp;
   fp = fopen(kernfile, "w");
   
-  fprintf(fp, "/* %s, Size: %u Bytes */\n", name, bdf_first_table_cnt*4 + bdf_second_table_cnt*3 + 4 + 8);  // size calculation for 16 bit controller
+  fprintf(fp, "/* %s, Size: %u Bytes, tables are sorted by encoding */\n", name, bdf_first_table_cnt*4 + bdf_second_table_cnt*3 + 4 + 8);  // size calculation for 16 bit controller
   bdf_write_uint16_array(fp, name, "first_encoding_table", bdf_first_table_cnt, bdf_first_encoding_table);
   bdf_write_uint16_array(fp, name, "index_to_second_table", bdf_first_table_cnt, bdf_index_to_second_table);
   bdf_write_uint16_array(fp, name, "second_encoding_table", bdf_second_table_cnt, bdf_second_encoding_table);
@@ -90,7 +91,8 @@ void bdf_write_kerning_file(const char *kernfile, const char *name)
   fprintf(fp, "  %s_%s,\n", name, "first_encoding_table");
   fprintf(fp, "  %s_%s,\n", name, "index_to_second_table");
   fprintf(fp, "  %s_%s,\n", name, "second_encoding_table");
-  fprintf(fp, "  %s_%s};\n\n", name, "kerning_values");
+  fprintf(fp, "  %s_%s,\n", name, "kerning_values");
+  fprintf(fp, "  1};\n\n");		/* is_sorted */
   fclose(fp);
 }
 
@@ -156,9 +158,26 @@ unsigned bdf_calculate_kerning(uint8_t *font, uint16_t e1, uint16_t e2, uint8_t
   return kerning;
 }
 
+static int bdf_compare_glyph_encoding(const void *a, const void *b)
+{
+  long e1 = (*(bg_t **)a)->encoding;
+  long e2 = (*(bg_t **)b)->encoding;
+  if ( e1 < e2 )
+    return -1;
+  if ( e1 > e2 )
+    return 1;
+  return 0;
+}
+
+/*
+  The first and the second encoding tables are sorted by encoding, so that
+  u8g2_GetKerning() can use a binary search. The glyph list of the bdf file
+  might not be sorted, so a sorted copy of the glyph list is used here.
+*/
 void bdf_calculate_all_kerning(bf_t *bf, const char *filename, const char *fontname, uint8_t min_distance_in_per_cent_of_char_width)
 {
   int first, second;
+  bg_t **glyph_list;
   bg_t *bg_first;
   bg_t *bg_second;
   uint8_t kerning;
@@ -168,15 +187,25 @@ void bdf_calculate_all_kerning(bf_t *bf, const char *filename, const char *fontn
   bdf_first_table_cnt = 0;
   bdf_second_table_cnt = 0;
   
+  glyph_list = (bg_t **)malloc(sizeof(bg_t *)*(bf->glyph_cnt+1));
+  if ( glyph_list == NULL )
+  {
+    fprintf(stderr, "Kerning calculation aborted: Out of memory\n");
+    return;
+  }
+  for( first = 0; first < bf->glyph_cnt; first++ )
+    glyph_list[first] = bf->glyph_list[first];
+  qsort(glyph_list, bf->glyph_cnt, sizeof(bg_t *), bdf_compare_glyph_encoding);
+  
   for( first= 0; first < bf->glyph_cnt; first++ )
   {
     is_first_encoding_added = 0;
-    bg_first = bf->glyph_list[first];
+    bg_first = glyph_list[first];
     if ( bg_first->target_data != NULL && bg_first->is_excluded_from_kerning == 0 )
     {
       for( second= 0; second < bf->glyph_cnt; second++ )
       {
-        bg_second = bf->glyph_list[second];
+        bg_second = glyph_list[second];
         if ( bg_second->target_data != NULL && bg_second->is_excluded_from_kerning == 0 )
         {
           kerning = bdf_calculate_kerning(bf->target_data, bg_first->encoding, bg_second->encoding, min_distance_in_per_cent_of_char_width);
@@ -190,6 +219,7 @@ void bdf_calculate_all_kerning(bf_t *bf, const char *filename, const char *fontn
 	      if (bdf_first_table_cnt > BDF_KERNING_MAX)
 	      {
 		      fprintf(stderr, "Kerning calculation aborted: bdf_first_table_cnt > BDF_KERNING_MAX\n");
+		      free(glyph_list);
 		      return;
 	      }
 	      is_first_encoding_added = 1;
@@ -200,6 +230,7 @@ void bdf_calculate_all_kerning(bf_t *bf, const char *filename, const char *fontn
 	    if (bdf_second_table_cnt > BDF_KERNING_MAX)
 	    {
 		      fprintf(stderr, "Kerning calculation aborted: bdf_second_table_cnt > BDF_KERNING_MAX\n");
+		      free(glyph_list);
 		      return;
 	    }
 	  }
@@ -207,6 +238,8 @@ void bdf_calculate_all_kerning(bf_t *bf, const char *filename, const char *fontn
       }
     }
   }
+  free(glyph_list);
+  
   /* add a final entry for more easier calculation in u8g2 */
   bdf_first_encoding_table[bdf_first_table_cnt] = 0x0ffff;
   bdf_index_to_second_table[bdf_first_table_cnt]  = bdf_second_table_cnt;
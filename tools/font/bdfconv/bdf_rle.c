@@ -62,6 +62,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <assert.h>
 #include "bdf_font.h"
 
@@ -930,3 +931,141 @@ void bf_RLECompressAllGlyphs(bf_t *bf)
 
 
 
+/*
+  Create a copy of the u8g2 font in bf->target_data with a glyph offset table
+  after the font header. The content of bf->target_data is not modified.
+  
+  The type of the table is stored in the upper two bits of the bbx_mode byte
+  (offset 1): 0x40 for a dense table, 0x80 for a sparse table.
+  The table starts at offset 23 (BDF_RLE_FONT_GLYPH_START):
+  
+    word	table size in bytes, the glyphs start at offset 23 + table size
+    word	number of entries
+    dense:	word first encoding, followed by one entry per encoding:
+		3 bytes offset of the glyph, 0x0ffffff if the glyph does not exist
+    sparse:	one entry per glyph, sorted by encoding:
+		word encoding, 3 bytes offset of the glyph
+  
+  All offsets (including the existing 'A', 'a' and unicode start positions) are 
+  relative to the first glyph and point to the encoding of the glyph.
+  
+  Returns NULL if no table is requested or if the table is too large.
+  Otherwise the new font is returned, cnt is set to the size of the new font.
+*/
+
+static void bf_rle_put_offset(uint8_t *p, uint32_t offset)
+{
+  p[0] = offset >> 16;
+  p[1] = (offset >> 8) & 255;
+  p[2] = offset & 255;
+}
+
+uint8_t *bf_RLECreateOffsetTableFont(bf_t *bf, int *cnt)
+{
+  uint8_t *font = bf->target_data + BDF_RLE_FONT_GLYPH_START;
+  uint8_t *p;
+  uint8_t *new_font;
+  uint32_t *pos_list;
+  long *enc_list;
+  long glyphs = 0;
+  long entries;
+  long table_size;
+  long i;
+  
+  if ( bf->offset_table_mode == BDF_OFFSET_TABLE_NONE )
+    return NULL;
+  
+  pos_list = (uint32_t *)malloc(sizeof(uint32_t)*(bf->selected_glyphs+1));
+  enc_list = (long *)malloc(sizeof(long)*(bf->selected_glyphs+1));
+  if ( pos_list == NULL || enc_list == NULL )
+  {
+    bf_Error(bf, "Offset table: Out of memory");
+    exit(1);
+  }
+  
+  /* collect the position of all glyphs, the encodings are sorted */
+  p = font;
+  while( p[1] != 0 )
+  {
+    enc_list[glyphs] = p[0];
+    pos_list[glyphs] = p - font;
+    glyphs++;
+    p += p[1];
+  }
+  p += 2;	/* skip the end marker of the ASCII section */
+  p += p[0]*256 + p[1];		/* skip the unicode lookup table */
+  while( p[0] != 0 || p[1] != 0 )
+  {
+    enc_list[glyphs] = p[0]*256 + p[1];
+    pos_list[glyphs] = p - font;
+    glyphs++;
+    p += p[2];
+  }
+  
+  if ( bf->offset_table_mode == BDF_OFFSET_TABLE_DENSE )
+  {
+    entries = glyphs == 0 ? 0 : enc_list[glyphs-1] - enc_list[0] + 1;
+    table_size = 6 + entries*3;
+  }
+  else
+  {
+    entries = glyphs;
+    table_size = 4 + entries*5;
+  }
+  
+  if ( table_size > 0x0ffff || bf->target_cnt > 0x0ffffff )
+  {
+    bf_Log(bf, "Offset table: Table size %ld too large, offset table not created", table_size);
+    free(pos_list);
+    free(enc_list);
+    return NULL;
+  }
+  
+  new_font = (uint8_t *)malloc(bf->target_cnt + table_size);
+  if ( new_font == NULL )
+  {
+    bf_Error(bf, "Offset table: Out of memory");
+    exit(1);
+  }
+  
+  memcpy(new_font, bf->target_data, BDF_RLE_FONT_GLYPH_START);
+  memcpy(new_font + BDF_RLE_FONT_GLYPH_START + table_size, font, bf->target_cnt - BDF_RLE_FONT_GLYPH_START);
+  
+  p = new_font + BDF_RLE_FONT_GLYPH_START;
+  p[0] = table_size >> 8;
+  p[1] = table_size & 255;
+  p[2] = entries >> 8;
+  p[3] = entries & 255;
+  if ( bf->offset_table_mode == BDF_OFFSET_TABLE_DENSE )
+  {
+    new_font[1] |= 0x40;
+    p[4] = glyphs == 0 ? 0 : enc_list[0] >> 8;
+    p[5] = glyphs == 0 ? 0 : enc_list[0] & 255;
+    p += 6;
+    for( i = 0; i < entries; i++ )
+      bf_rle_put_offset(p + i*3, 0x0ffffff);
+    for( i = glyphs-1; i >= 0; i-- )	/* backwards: the first glyph wins, like in the linear search */
+      bf_rle_put_offset(p + (enc_list[i] - enc_list[0])*3, pos_list[i]);
+  }
+  else
+  {
+    new_font[1] |= 0x80;
+    p += 4;
+    for( i = 0; i < glyphs; i++ )
+    {
+      p[0] = enc_list[i] >> 8;
+      p[1] = enc_list[i] & 255;
+      bf_rle_put_offset(p + 2, pos_list[i]);
+      p += 5;
+    }
+  }
+  
+  bf_Log(bf, "Offset table: %s table, glyphs=%ld, entries=%ld, size=%ld", 
+    bf->offset_table_mode == BDF_OFFSET_TABLE_DENSE ? "Dense" : "Sparse", glyphs, entries, table_size);
+  
+  free(pos_list);
+  free(enc_list);
+  *cnt = bf->target_cnt + table_size;
+  return new_font;
+}
+
@@ -132,6 +132,7 @@ void help(void)
   printf("-v          Print log messages\n");
   printf("-b <n>      Font build mode, 0: proportional, 1: common height, 2: monospace, 3: multiple of 8, 4: 5x7 mode\n");
   printf("-f <n>      Font format, 0: ucglib font, 1: u8g2 font, 2: u8g2 uncompressed 8x8 font (enforces -b 3)\n");
+  printf("-i <n>      Glyph offset table, 0: none (default), 1: dense, 2: sparse (requires -f 1)\n");
   printf("-m 'map'    Unicode ASCII mapping\n");
   printf("-M 'mapfile'    Read Unicode ASCII mapping from file 'mapname'\n");
   printf("-o <file>   C output font file\n");
@@ -186,6 +187,7 @@ void help(void)
 unsigned long left_margin = 1;
 unsigned long build_bbx_mode = 0;
 unsigned long font_format = 0;
+unsigned long offset_table_mode = BDF_OFFSET_TABLE_NONE;
 unsigned long min_distance_in_per_cent_of_char_width = 25;
 unsigned long cmdline_glyphs_per_line = 16;
 unsigned long xoffset = 0;
@@ -394,6 +396,9 @@ int main(int argc, char **argv)
     else if ( get_num_arg(&argv, 'f', &font_format) != 0 )
     {
     }
+    else if ( get_num_arg(&argv, 'i', &offset_table_mode) != 0 )
+    {
+    }
     else if ( get_num_arg(&argv, 'x', &xoffset) != 0 )
     {
     }
@@ -513,6 +518,8 @@ int main(int argc, char **argv)
     else
     {
       /* font format >= 1 are for u8g2, the following procedure just writes the content to the file */
+      if ( font_format == 1 )
+        bf->offset_table_mode = offset_table_mode;	/* the offset table is added by bf_WriteU8G2CByFP() */
       bf_WriteU8G2CByFilename(bf, c_filename, target_fontname, "  ");	/* bdf_font.c */
     }
   }